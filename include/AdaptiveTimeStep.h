@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ADAPTIVE_TIME_STEP_H
+#define ADAPTIVE_TIME_STEP_H
+
+#include "MainVariables.h"
+#include "SciantixContext.h"
+#include <vector>
+
+/// SciantixState
+/// In-memory snapshot of the state advanced by a time step (Sciantix_variables, Sciantix_diffusion_modes),
+/// restored when a time step is rejected, with their derivatives if the context has tangents (sciantix_tangent).
+struct SciantixState
+{
+	double variables[300];
+	double diffusion_modes[1000];
+
+	/// Tangents of variables and diffusion_modes, one after the other (empty without tangents)
+	std::vector<double> tangents;
+
+	void save(const SciantixContext& context);
+	void restore(SciantixContext& context) const;
+};
+
+/// AdaptiveTimeStepping
+/// Simulates the input history (from Time_h = 0 to Time_end_h) with time steps controlled by step doubling:
+/// each step is computed with one step dt and with two steps dt/2, the difference of the key variables
+/// estimates the local error. Steps with error above the tolerance are rejected and retried with a shorter dt,
+/// the following dt is grown or shrunk to meet the tolerance. The steps do not cross the points of the input history.
+/// The first dt of each history interval is the one of TimeStepCalculation (Number_of_time_steps_per_interval).
+/// Output is written (or stored in context.results) for the accepted steps only. Returns the number of accepted time steps.
+long long AdaptiveTimeStepping(SciantixContext& context, double tolerance, long long& rejected_steps);
+
+#endif // ADAPTIVE_TIME_STEP_H
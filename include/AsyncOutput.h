@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASYNC_OUTPUT_H
+#define ASYNC_OUTPUT_H
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "OutputSink.h"
+#include "ColumnarOutput.h"
+
+/// AsyncOutputWriter
+/// Output written by a background thread (iAsyncOutput = 1). The time loop pushes the values of each row in a
+/// single-producer/single-consumer ring buffer (lock-free, bounded), the writer thread formats and writes them
+/// (output.txt via OutputSink, or output.bin via ColumnarOutputWriter). When the ring is full the time loop waits
+/// for a free slot (back-pressure). Rows must be pushed by one thread, the one running the time loop.
+
+class AsyncOutputWriter
+{
+protected:
+	OutputSink* text;
+	ColumnarOutputWriter* columnar;
+	std::size_t n_columns;
+	std::size_t n_history_columns;
+
+	/// Ring of capacity rows of n_columns values
+	std::size_t capacity;
+	std::vector<double> ring;
+	std::atomic<std::size_t> head;
+	std::atomic<std::size_t> tail;
+
+	std::atomic<bool> running;
+	std::thread writer;
+
+	/// Writer thread: formats and writes the rows until stop
+	void run();
+
+public:
+	/// Starts the writer thread, for rows of n_columns values (the first n_history_columns are history variables).
+	/// Output to text (if not null) or to columnar.
+	void start(OutputSink* text, ColumnarOutputWriter* columnar, std::size_t n_columns, std::size_t n_history_columns);
+
+	bool isRunning() const
+	{
+		return running.load(std::memory_order_relaxed);
+	}
+
+	/// Copies a row in the ring, waiting for a free slot if the ring is full
+	void push(const double* row);
+
+	/// Waits until the writer thread has written all the rows pushed
+	void drain();
+
+	/// Drains the ring and stops the writer thread
+	void stop();
+
+	/// Number of pushes that waited for a free slot
+	long long full_waits;
+
+	AsyncOutputWriter(std::size_t capacity = 4096);
+	~AsyncOutputWriter();
+
+	AsyncOutputWriter(const AsyncOutputWriter&) = delete;
+	AsyncOutputWriter& operator=(const AsyncOutputWriter&) = delete;
+};
+
+/// Writes a row of output.txt: history variables with 10 significant digits, sciantix variables with 7
+void WriteTextRow(OutputSink& text, const double* row, std::size_t n_columns, std::size_t n_history_columns);
+
+#endif // ASYNC_OUTPUT_H
@@ -0,0 +1,32 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BATCH_RUN_H
+#define BATCH_RUN_H
+
+#include <string>
+
+/// RunBatch
+/// Batch mode of SCIANTIX (sciantix.x --batch manifest.txt [--threads N]): simulates the cases listed in the manifest,
+/// in-process and at the same time, on a pool of worker threads (see WorkStealingPool.h).
+/// The manifest lists one case directory per line, relative to the directory of the manifest (lines starting with '#' are comments).
+/// Each case reads its input files and writes its output files in its directory, as sciantix.x run in that directory (see RunSciantixCase).
+/// The errors of a case (e.g., a missing input file) end that case only: they are reported, the other cases go on.
+/// With iTrace = 1 in any case, the events of all the cases are written in trace.json, in the directory of the manifest.
+/// n_threads <= 0: one thread per core. Returns the number of failed cases (or 1 if the manifest cannot be read).
+int RunBatch(const std::string& manifest_name, int n_threads);
+
+#endif // BATCH_RUN_H
@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef COLUMNAR_OUTPUT_H
+#define COLUMNAR_OUTPUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+/// Binary columnar output (output.bin, iOutput = 3)
+/// The file is self-describing and organized in chunks of rows (time steps), each chunk stored by column:
+///   header: magic "SCXCOL1" + '\0', int32 number of columns, int32 rows per chunk,
+///           for each column: int32 kind (0 = history variable, 1 = sciantix variable),
+///                            int32 length + name, int32 length + unit of measure,
+///           zero padding to a multiple of 8 bytes;
+///   chunks: int64 number of rows n, then n doubles for each column (column after column).
+/// All the values are stored in native byte order, with full double precision.
+
+/// OutputColumn
+/// Description of a column of the columnar output
+struct OutputColumn
+{
+	std::string name;
+	std::string uom;
+	int kind; // 0 = history variable, 1 = sciantix variable
+};
+
+/// ColumnarOutputWriter
+/// Writes the columnar output: the rows are collected by column in a chunk, written to the file when full.
+class ColumnarOutputWriter
+{
+protected:
+	std::FILE* file;
+	std::vector<OutputColumn> columns;
+	std::size_t chunk_rows;
+	std::size_t rows;
+	std::vector<double> chunk;
+
+public:
+	/// Creates (or truncates) the file and writes the header
+	bool open(const std::string& name, const std::vector<OutputColumn>& columns);
+
+	bool isOpen() const
+	{
+		return file != nullptr;
+	}
+
+	/// Appends a row, one value per column
+	void writeRow(const double* values);
+
+	/// Writes the rows collected in the current chunk
+	void flush();
+
+	void close();
+
+	ColumnarOutputWriter(std::size_t chunk_rows = 4096);
+	~ColumnarOutputWriter();
+
+	ColumnarOutputWriter(const ColumnarOutputWriter&) = delete;
+	ColumnarOutputWriter& operator=(const ColumnarOutputWriter&) = delete;
+};
+
+/// ColumnarOutputReader
+/// Reader of the columnar output: the file is memory-mapped, a column is read from each chunk without touching the others.
+class ColumnarOutputReader
+{
+protected:
+	MappedFile file;
+	std::vector<OutputColumn> columns;
+
+	/// Offset of the first value, number of rows and first row of each chunk
+	std::vector<std::size_t> chunk_offset;
+	std::vector<std::size_t> chunk_rows;
+	std::vector<std::size_t> chunk_first_row;
+	std::size_t rows;
+
+public:
+	/// Maps the file and reads the header and the chunk sizes; returns false if the file is not a columnar output
+	bool open(const std::string& name);
+
+	void close();
+
+	std::size_t getRows() const
+	{
+		return rows;
+	}
+
+	const std::vector<OutputColumn>& getColumns() const
+	{
+		return columns;
+	}
+
+	/// Index of the column with this name, or header ("Name (UOM)", as in output.txt); -1 if not found
+	int findColumn(const std::string& name) const;
+
+	/// Values of the column, for all the rows
+	std::vector<double> getColumn(int index) const;
+
+	/// Value of the column at a row
+	double getValue(int index, std::size_t row) const;
+
+	ColumnarOutputReader();
+	~ColumnarOutputReader() { }
+
+	ColumnarOutputReader(const ColumnarOutputReader&) = delete;
+	ColumnarOutputReader& operator=(const ColumnarOutputReader&) = delete;
+};
+
+#endif // COLUMNAR_OUTPUT_H
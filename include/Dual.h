@@ -0,0 +1,247 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <cmath>
+#include <ostream>
+
+/// Dual
+/// Forward-mode automatic differentiation: a value together with its derivatives (tangents) along K directions
+/// (e.g., d/d sf_diffusivity, d/d temperature). Every operation propagates the tangents with the chain rule,
+/// hence a computation on Dual numbers returns the exact derivatives of its result, besides the value.
+/// Comparisons act on the values only: the branches taken are the ones of the computation on doubles.
+
+template <int K>
+class Dual
+{
+public:
+	double value;
+	double tangent[K];
+
+	Dual() : value(0.0), tangent() { }
+
+	Dual(double v) : value(v), tangent() { }
+
+	Dual(double v, const double t[K]) : value(v)
+	{
+		for (int k = 0; k < K; ++k)
+			tangent[k] = t[k];
+	}
+
+	/// Independent variable, seeded along the direction k
+	static Dual variable(double v, int k)
+	{
+		Dual x(v);
+		x.tangent[k] = 1.0;
+		return x;
+	}
+
+	Dual& operator+=(const Dual& b)
+	{
+		value += b.value;
+		for (int k = 0; k < K; ++k)
+			tangent[k] += b.tangent[k];
+		return *this;
+	}
+
+	Dual& operator-=(const Dual& b)
+	{
+		value -= b.value;
+		for (int k = 0; k < K; ++k)
+			tangent[k] -= b.tangent[k];
+		return *this;
+	}
+
+	Dual& operator*=(const Dual& b)
+	{
+		for (int k = 0; k < K; ++k)
+			tangent[k] = tangent[k] * b.value + value * b.tangent[k];
+		value *= b.value;
+		return *this;
+	}
+
+	Dual& operator/=(const Dual& b)
+	{
+		value /= b.value;
+		for (int k = 0; k < K; ++k)
+			tangent[k] = (tangent[k] - value * b.tangent[k]) / b.value;
+		return *this;
+	}
+
+	friend Dual operator+(Dual a, const Dual& b) { return a += b; }
+	friend Dual operator-(Dual a, const Dual& b) { return a -= b; }
+	friend Dual operator*(Dual a, const Dual& b) { return a *= b; }
+	friend Dual operator/(Dual a, const Dual& b) { return a /= b; }
+
+	friend Dual operator+(const Dual& a) { return a; }
+	friend Dual operator-(const Dual& a)
+	{
+		Dual r(-a.value);
+		for (int k = 0; k < K; ++k)
+			r.tangent[k] = -a.tangent[k];
+		return r;
+	}
+
+	/// Conditions on a number (e.g., if (x)) test its value
+	explicit operator bool() const { return value != 0.0; }
+
+	friend bool operator==(const Dual& a, const Dual& b) { return a.value == b.value; }
+	friend bool operator!=(const Dual& a, const Dual& b) { return a.value != b.value; }
+	friend bool operator<(const Dual& a, const Dual& b) { return a.value < b.value; }
+	friend bool operator<=(const Dual& a, const Dual& b) { return a.value <= b.value; }
+	friend bool operator>(const Dual& a, const Dual& b) { return a.value > b.value; }
+	friend bool operator>=(const Dual& a, const Dual& b) { return a.value >= b.value; }
+
+	/// The output streams (output.txt, overview.txt) receive the value
+	friend std::ostream& operator<<(std::ostream& os, const Dual& a) { return os << a.value; }
+};
+
+/// Function of one variable, f(a) with derivative df = f'(a).
+/// The directions along which a is constant stay constant, also where f' is not finite (e.g., sqrt(0), pow(0, 1/3)).
+template <int K>
+Dual<K> Chain(const Dual<K>& a, double f, double df)
+{
+	Dual<K> r(f);
+	for (int k = 0; k < K; ++k)
+		r.tangent[k] = (a.tangent[k] != 0.0) ? df * a.tangent[k] : 0.0;
+	return r;
+}
+
+template <int K>
+Dual<K> exp(const Dual<K>& a)
+{
+	const double f = std::exp(a.value);
+	return Chain(a, f, f);
+}
+
+template <int K>
+Dual<K> expm1(const Dual<K>& a)
+{
+	return Chain(a, std::expm1(a.value), std::exp(a.value));
+}
+
+template <int K>
+Dual<K> log(const Dual<K>& a)
+{
+	return Chain(a, std::log(a.value), 1.0 / a.value);
+}
+
+template <int K>
+Dual<K> log10(const Dual<K>& a)
+{
+	return Chain(a, std::log10(a.value), 1.0 / (a.value * std::log(10.0)));
+}
+
+template <int K>
+Dual<K> sqrt(const Dual<K>& a)
+{
+	const double f = std::sqrt(a.value);
+	return Chain(a, f, 0.5 / f);
+}
+
+template <int K>
+Dual<K> sin(const Dual<K>& a)
+{
+	return Chain(a, std::sin(a.value), std::cos(a.value));
+}
+
+template <int K>
+Dual<K> cos(const Dual<K>& a)
+{
+	return Chain(a, std::cos(a.value), - std::sin(a.value));
+}
+
+template <int K>
+Dual<K> abs(const Dual<K>& a)
+{
+	return a.value < 0.0 ? -a : a;
+}
+
+template <int K>
+Dual<K> fabs(const Dual<K>& a)
+{
+	return abs(a);
+}
+
+template <int K>
+Dual<K> hypot(const Dual<K>& a, const Dual<K>& b)
+{
+	const double f = std::hypot(a.value, b.value);
+	Dual<K> r(f);
+	for (int k = 0; k < K; ++k)
+		r.tangent[k] = (f > 0.0) ? (a.value * a.tangent[k] + b.value * b.tangent[k]) / f : 0.0;
+	return r;
+}
+
+template <int K>
+Dual<K> pow(const Dual<K>& a, double b)
+{
+	if (b == 0.0)
+		return Dual<K>(1.0);
+
+	const double f = std::pow(a.value, b);
+	return Chain(a, f, b * std::pow(a.value, b - 1.0));
+}
+
+template <int K>
+Dual<K> pow(double a, const Dual<K>& b)
+{
+	const double f = std::pow(a, b.value);
+	return Chain(b, f, f * std::log(a));
+}
+
+template <int K>
+Dual<K> pow(const Dual<K>& a, const Dual<K>& b)
+{
+	const double f = std::pow(a.value, b.value);
+	Dual<K> r(f);
+	for (int k = 0; k < K; ++k)
+	{
+		if (a.tangent[k] != 0.0)
+			r.tangent[k] += b.value * std::pow(a.value, b.value - 1.0) * a.tangent[k];
+		if (b.tangent[k] != 0.0)
+			r.tangent[k] += f * std::log(a.value) * b.tangent[k];
+	}
+	return r;
+}
+
+/// Value of a number, without derivatives
+inline double Value(double a)
+{
+	return a;
+}
+
+template <int K>
+double Value(const Dual<K>& a)
+{
+	return a.value;
+}
+
+/// Derivative of a number along the direction k (zero for a double)
+inline double Tangent(double, int)
+{
+	return 0.0;
+}
+
+template <int K>
+double Tangent(const Dual<K>& a, int k)
+{
+	return a.tangent[k];
+}
+
+#endif // DUAL_H
@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include <string>
+#include <vector>
+
+/// EnsembleFactor
+/// Scaling factor (entry of Sciantix_scaling_factors) varied by the ensemble, sampled in [lower, upper]
+/// with uniform or log-uniform distribution
+struct EnsembleFactor
+{
+	int index;
+	std::string name;
+	bool logarithmic;
+	double lower;
+	double upper;
+};
+
+/// EnsembleSpecification
+/// Sensitivity study over the scaling factors of a case, read from the specification file (e.g., input_ensemble.txt),
+/// one "key = value" per line ('#' starts a comment):
+///   samples = 1000
+///   sampling = lhs                          (random, lhs = Latin hypercube, sobol = Sobol sequence)
+///   seed = 1                                (random, lhs)
+///   sf_diffusivity = loguniform 0.1 10      (any of the names of input_scaling_factors.txt, uniform or loguniform)
+///   output = Intragranular gas bubble swelling (/)     (figure of merit: name, or header as in output.txt)
+struct EnsembleSpecification
+{
+	int samples = 100;
+	std::string sampling = "random";
+	unsigned long long seed = 1;
+	std::vector<EnsembleFactor> factors;
+	std::vector<std::string> outputs;
+};
+
+/// Reads the specification file (errors are reported by ErrorMessages::InvalidInputFile, with the line)
+EnsembleSpecification ReadEnsembleSpecification(const std::string& file_name);
+
+/// Points of the sampling in the unit hypercube [0, 1)^dimensions, one vector of dimensions coordinates per sample.
+/// "sobol": the points 1, ..., samples of the Sobol sequence (direction numbers of Joe and Kuo, up to 10 dimensions)
+std::vector<std::vector<double>> EnsembleSamples(const std::string& sampling, int samples, int dimensions, unsigned long long seed);
+
+/// RunEnsemble
+/// Ensemble mode of SCIANTIX (sciantix.x --ensemble input_ensemble.txt [--threads N]): simulates the case of the directory
+/// of the specification file once per sample of the scaling factors, in-process, on a pool of worker threads (see WorkStealingPool.h).
+/// The input files are read once; the input history is parsed once and shared by the threads (HistorySource::attach).
+/// The samples are simulated without output; the final values of the figures of merit are written in ensemble.txt
+/// (same directory), one row per sample, after the row 0 of the nominal case (scaling factors of input_scaling_factors.txt).
+/// n_threads <= 0: one thread per core. Returns the number of failed samples.
+int RunEnsemble(const std::string& specification_name, int n_threads);
+
+#endif // ENSEMBLE_H
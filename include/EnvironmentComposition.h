@@ -20,6 +20,7 @@
 #include "SciantixVariableDeclaration.h"
 #include "HistoryVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "MapModel.h"
 #include "MapSciantixVariable.h"
 #include "MapHistoryVariable.h"
 
@@ -14,14 +14,31 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#ifndef ERROR_MESSAGES_H
+#define ERROR_MESSAGES_H
+
 #include <string>
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
 #include <fstream>
+#include <stdexcept>
 
 namespace ErrorMessages
 {
+	/// Error of the simulated case, thrown instead of aborting the execution if SetThrowOnError(true) (see BatchRun.h)
+	class Error : public std::runtime_error
+	{
+	public:
+		explicit Error(const std::string& message) : std::runtime_error(message) { }
+	};
+
+	/// If true, the errors of the cases simulated by this thread throw ErrorMessages::Error, instead of calling exit
+	void SetThrowOnError(bool throw_on_error);
+
 	void MissingInputFile(const char* exception);
+	void InvalidInputFile(const char* file_name, long long point);
 	void Switch(std::string routine, std::string variable_name, int variable);
 };
+
+#endif // ERROR_MESSAGES_H
@@ -20,6 +20,6 @@
 #include <vector>
 #include "Gas.h"
 
-extern std::vector<Gas> gas;
+extern thread_local std::vector<Gas> gas;
 
 #endif // GAS_DECLARATION_H
@@ -58,6 +58,16 @@ void defineSpectralDiffusion2Equations();
  */
 void defineSpectralDiffusion3Equations();
 
+/**
+ * @brief Number of modes of the spectral diffusion solvers (iDiffusionModes, 0 = n_modes).
+ */
+int spectralDiffusionModes();
+
+/**
+ * @brief Relative tolerance of the adaptive truncation of the modes (iAdaptiveModes = k: 10^-k, 0 = no truncation).
+ */
+double spectralDiffusionTolerance();
+
 /**
  * @brief Handles unsupported diffusion solver options.
  */
@@ -16,6 +16,7 @@
 
 #include "SciantixVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "MapModel.h"
 #include "MapSciantixVariable.h"
 
 void GrainBoundarySweeping();
@@ -17,6 +17,7 @@
 #include "SciantixVariableDeclaration.h"
 #include "HistoryVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "MapModel.h"
 #include "SciantixScalingFactorDeclaration.h"
 
 #include "MapSciantixVariable.h"
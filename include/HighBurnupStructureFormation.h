@@ -20,6 +20,7 @@
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
 #include "ModelDeclaration.h"
+#include "MapModel.h"
 
 /**
  * @brief HighBurnupStructureFormation
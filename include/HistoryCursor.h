@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HISTORY_CURSOR_H
+#define HISTORY_CURSOR_H
+
+#include <deque>
+#include "HistorySource.h"
+
+/// HistoryCursor
+/// This class interpolates the input history (temperature, fission rate, hydrostatic stress, steam pressure) at the time
+/// of the time step. It holds the current history interval, moved from the previous one: since the time advances
+/// monotonically, each lookup costs O(1) amortized instead of a bisection over the history points per channel.
+/// The points are read lazily from a HistorySource, keeping only a short window around the current interval.
+/// The values and the interval are the ones of InputInterpolation and TimeStepCalculation.
+
+class HistoryCursor
+{
+protected:
+	HistorySource& source;
+
+	/// Points [window_first, window_first + window.size()) of the history
+	std::deque<HistoryPoint> window;
+	long long window_first;
+	bool source_end;
+
+	/// First two points of the history (the second one is the first again, for histories of one point)
+	HistoryPoint first[2];
+	bool single_point;
+
+	/// Last history point with time <= x (-1 before the first point)
+	long long interval;
+
+	double x;
+	double temperature_value;
+	double fission_rate_value;
+	double hydrostatic_stress_value;
+	double steam_pressure_value;
+
+	/// Reads the history up to point k, returns false if k is beyond the last point
+	bool load(long long k);
+
+	const HistoryPoint& point(long long k) const
+	{
+		return window[k - window_first];
+	}
+
+	/// True if point k is in the window (after seek, the point following the interval is loaded if it exists)
+	bool has(long long k) const
+	{
+		return k < window_first + static_cast<long long>(window.size());
+	}
+
+	void restart();
+
+public:
+	/// Moves the cursor to the time x (h) and interpolates all the channels
+	void seek(double x);
+
+	double getTime() const
+	{
+		return x;
+	}
+
+	double getTemperature() const
+	{
+		return temperature_value;
+	}
+
+	double getFissionRate() const
+	{
+		return fission_rate_value;
+	}
+
+	double getHydrostaticStress() const
+	{
+		return hydrostatic_stress_value;
+	}
+
+	double getSteamPressure() const
+	{
+		return steam_pressure_value;
+	}
+
+	/// Bounds of the history interval containing x (lower <= x < upper), both 0 if x is outside the history
+	double getLowerBound() const
+	{
+		return (interval >= 0 && has(interval + 1)) ? point(interval).time : 0.0;
+	}
+
+	double getUpperBound() const
+	{
+		return (interval >= 0 && has(interval + 1)) ? point(interval + 1).time : 0.0;
+	}
+
+	/// First history point after x (the last point if x is beyond the history)
+	double getNextPoint() const
+	{
+		return has(interval + 1) ? point(interval + 1).time : source.getEndTime();
+	}
+
+	HistoryCursor(HistorySource& source);
+	~HistoryCursor() { }
+};
+
+#endif // HISTORY_CURSOR_H
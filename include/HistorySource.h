@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HISTORY_SOURCE_H
+#define HISTORY_SOURCE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+/// HistoryPoint
+/// One point of the input history
+struct HistoryPoint
+{
+	double time;               // (h)
+	double temperature;        // (K)
+	double fission_rate;       // (fiss / m3 s)
+	double hydrostatic_stress; // (MPa)
+	double steam_pressure;     // (atm), 0 if not in the history
+};
+
+/// HistorySource
+/// This class reads the points of the input history lazily, one at a time, from a memory-mapped file:
+/// the memory used and the time to open the history do not depend on its length.
+/// Two formats are supported:
+/// - text (input_history.txt): time, temperature, fission rate, hydrostatic stress (and steam pressure, if iStoichiometryDeviation > 0)
+///   separated by white spaces, one point per line, parsed with std::from_chars;
+/// - binary (input_history.bin): a header (magic, number of columns, number of points) and the points as double,
+///   written by ConvertHistory (utilities/historyConverter).
+
+class HistorySource
+{
+protected:
+	std::string name;
+	MappedFile file;
+	const char* data;
+	std::size_t size;
+	bool binary;
+	int columns;
+	long long n_points; // -1 until the end of a text history is reached
+	std::size_t position;
+	long long point_index;
+	double end_time;
+
+	bool nextText(HistoryPoint& point);
+	bool nextBinary(HistoryPoint& point);
+	void close();
+
+	/// Reads the header (binary) or the end time (text) of the history in data
+	bool parse(int text_columns);
+
+public:
+	/// Maps the file name; columns = 4 or 5 (with steam pressure) for text files. Returns false if the file does not exist
+	bool open(const std::string& file_name, int columns);
+
+	/// Reads the history from a binary image in memory (see readBinaryImage), owned by the caller and not modified:
+	/// e.g., the history parsed once and read by several threads, each one with its own HistorySource
+	bool attach(const char* image, std::size_t image_size);
+
+	/// Writes the whole history to image, in the format of input_history.bin
+	void readBinaryImage(std::vector<char>& image);
+
+	/// Reads the next point, returns false at the end of the history
+	bool next(HistoryPoint& point);
+
+	/// Restarts from the first point
+	void rewind();
+
+	/// Time of the last point (h)
+	double getEndTime() const
+	{
+		return end_time;
+	}
+
+	bool isBinary() const
+	{
+		return binary;
+	}
+
+	/// Number of columns of the points (4, or 5 with the steam pressure)
+	int getColumns() const
+	{
+		return columns;
+	}
+
+	HistorySource();
+	~HistorySource();
+
+	HistorySource(const HistorySource&) = delete;
+	HistorySource& operator=(const HistorySource&) = delete;
+};
+
+/// ConvertHistory
+/// Writes the text history text_name (with 4 or 5 columns) to the binary history binary_name.
+/// Returns the number of points, -1 if a file cannot be opened.
+long long ConvertHistory(const std::string& text_name, const std::string& binary_name, int columns);
+
+#endif // HISTORY_SOURCE_H
@@ -22,7 +22,7 @@
 
 /// Extern declaration of the input_variable vector
 
-extern std::vector<InputVariable> input_variable;
+extern thread_local std::vector<InputVariable> input_variable;
 
 #endif
 
@@ -15,27 +15,29 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include <vector>
+#include <string>
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include "HistorySource.h"
 
-extern clock_t timer, timer_time_step;
+// The state of the simulated case is per thread: the cases of a batch (sciantix.x --batch) run concurrently.
+extern thread_local clock_t timer, timer_time_step;
 
-extern int Sciantix_options[40];
-extern double Sciantix_history[20];
-extern double Sciantix_variables[300];
-extern double Sciantix_scaling_factors[10];
-extern double Sciantix_diffusion_modes[1000];
+extern thread_local int Sciantix_options[40];
+extern thread_local double Sciantix_history[20];
+extern thread_local double Sciantix_variables[300];
+extern thread_local double Sciantix_scaling_factors[10];
+extern thread_local double Sciantix_diffusion_modes[1000];
 
-extern long long int Time_step_number;
-extern double  Time_h, dTime_h, Time_end_h;
-extern double  Time_s, Time_end_s;
-extern double  Number_of_time_steps_per_interval;
+extern thread_local long long int Time_step_number;
+extern thread_local double  Time_h, dTime_h, Time_end_h;
+extern thread_local double  Time_s, Time_end_s;
+extern thread_local double  Number_of_time_steps_per_interval;
 
-extern std::ofstream Output_file;
-extern std::ofstream Execution_file;
+extern thread_local std::ofstream Output_file;
+extern thread_local std::ofstream Execution_file;
 
-extern int Input_history_points;
 extern int Temperature_input_points;
 extern int Fissionrate_input_points;
 extern int Hydrostaticstress_input_points;
@@ -44,8 +46,11 @@ extern std::vector<double> Time_temperature_input;
 extern std::vector<double> Time_fissionrate_input;
 extern std::vector<double> Time_hydrostaticstress_input;
 extern std::vector<double> Time_steampressure_input;
-extern std::vector<double> Time_input;
-extern std::vector<double> Temperature_input;
-extern std::vector<double> Fissionrate_input;
-extern std::vector<double> Hydrostaticstress_input;
-extern std::vector<double> Steampressure_input;
\ No newline at end of file
+extern thread_local HistorySource Input_history;
+extern thread_local std::vector<std::string> Output_columns;
+
+/// Directory of the input and output files of the case simulated by this thread (the working directory, if empty)
+extern thread_local std::string Case_directory;
+
+/// Path of a file of the case, in Case_directory
+std::string CasePath(const std::string& file_name);
\ No newline at end of file
@@ -17,11 +17,23 @@
 #ifndef MAP_GAS
 #define MAP_GAS
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "GasDeclaration.h"
 
-extern std::map<std::string, int> ga;
+/// Handles of the gases, in order of definition (SetGas)
+
+enum GasHandle
+{
+	ga_xe,
+	ga_xe133,
+	ga_kr,
+	ga_kr85m,
+	ga_he,
+	n_gases
+};
+
+extern thread_local NameMap ga;
 
 void MapGas();
 
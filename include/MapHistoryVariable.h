@@ -17,11 +17,24 @@
 #ifndef MAP_HISTORY_VARIABLE
 #define MAP_HISTORY_VARIABLE
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "HistoryVariableDeclaration.h"
 
-extern std::map<std::string, int> hv;
+/// Handles of the history variables, in order of definition (SetVariables)
+
+enum HistoryVariableHandle
+{
+	hv_time,
+	hv_time_step_number,
+	hv_temperature,
+	hv_fission_rate,
+	hv_hydrostatic_stress,
+	hv_steam_pressure,
+	n_history_variables
+};
+
+extern thread_local NameMap hv;
 
 void MapHistoryVariable();
 
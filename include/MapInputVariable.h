@@ -17,11 +17,52 @@
 #ifndef MAP_INPUT_VARIABLE_H
 #define MAP_INPUT_VARIABLE_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "InputVariableDeclaration.h"
 
-extern std::map<std::string, int> iv;
+/// Handles of the input settings, in order of Sciantix_options
+
+enum InputVariableHandle
+{
+	iv_grain_growth,
+	iv_fg_diffusion_coefficient,
+	iv_diffusion_solver,
+	iv_intra_granular_bubble_evolution,
+	iv_resolution_rate,
+	iv_trapping_rate,
+	iv_nucleation_rate,
+	iv_output,
+	iv_grain_boundary_vacancy_diffusivity,
+	iv_grain_boundary_behaviour,
+	iv_grain_boundary_micro_cracking,
+	iv_fuel_matrix,
+	iv_grain_boundary_venting,
+	iv_radioactive_fission_gas,
+	iv_helium,
+	iv_he_diffusivity,
+	iv_grain_boundary_sweeping,
+	iv_high_burnup_structure_formation,
+	iv_high_burnup_structure_porosity,
+	iv_helium_production_rate,
+	iv_stoichiometry_deviation,
+	iv_bubble_diffusivity,
+	iv_diffusion_integrator,
+	iv_adaptive_time_step,
+	iv_async_output,
+	iv_output_stride,
+	iv_output_at_history_points,
+	iv_output_change_threshold,
+	iv_profiling,
+	iv_trace,
+	iv_state_precision,
+	iv_diffusion_modes,
+	iv_adaptive_modes,
+	iv_newton_warm_start,
+	n_input_variables
+};
+
+extern thread_local NameMap iv;
 
 void MapInputVariable();
 
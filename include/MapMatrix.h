@@ -17,14 +17,20 @@
 #ifndef MAP_MATRIX_H
 #define MAP_MATRIX_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "MatrixDeclaration.h"
 
-extern std::map<std::string, int> sma;
+extern thread_local NameMap sma;
+
+/// Handles of the matrices, set by their definitions
+extern thread_local int sma_uo2;
+extern thread_local int sma_uo2hbs;
 
 void MapMatrix();
 
+void ResetMatrixHandles();
+
 #endif // MAP_MATRIX_H
 
 
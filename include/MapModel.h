@@ -17,13 +17,32 @@
 #ifndef MAP_MODEL_H
 #define MAP_MODEL_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "ModelDeclaration.h"
 
-extern std::map<std::string, int> sm;
+extern thread_local NameMap sm;
+
+/// Handles of the models, set by their definitions.
+/// The per-system models (gas production, gas diffusion) are handled by System.
+extern thread_local int sm_burnup;
+extern thread_local int sm_effective_burnup;
+extern thread_local int sm_environment_composition;
+extern thread_local int sm_uo2_thermochemistry;
+extern thread_local int sm_stoichiometry_deviation;
+extern thread_local int sm_high_burnup_structure_formation;
+extern thread_local int sm_high_burnup_structure_porosity;
+extern thread_local int sm_grain_growth;
+extern thread_local int sm_grain_boundary_sweeping;
+extern thread_local int sm_intragranular_bubble_evolution;
+extern thread_local int sm_gas_diffusion_xe_in_uo2_with_hbs;
+extern thread_local int sm_grain_boundary_micro_cracking;
+extern thread_local int sm_grain_boundary_venting;
+extern thread_local int sm_intergranular_bubble_evolution;
 
 void MapModel();
 
+void ResetModelHandles();
+
 #endif // MAP_MODEL_H
 
@@ -17,11 +17,19 @@
 #ifndef MAP_PHYSICS_VARIABLE_H
 #define MAP_PHYSICS_VARIABLE_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "PhysicsVariableDeclaration.h"
 
-extern std::map<std::string, int> pv;
+/// Handles of the physics variables, in order of definition (SetVariables)
+
+enum PhysicsVariableHandle
+{
+	pv_time_step,
+	n_physics_variables
+};
+
+extern thread_local NameMap pv;
 
 void MapPhysicsVariable();
 
@@ -17,11 +17,120 @@
 #ifndef MAP_SCIANTIX_VARIABLE_H
 #define MAP_SCIANTIX_VARIABLE_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "SciantixVariableDeclaration.h"
 
-extern std::map<std::string, int> sv;
+/// Handles of the sciantix variables, in order of definition (SetVariables).
+/// "U" and "Specific power" are defined twice: the map sv refers to the last definition.
+
+enum SciantixVariableHandle
+{
+	sv_grain_radius,
+	sv_xe_produced,
+	sv_xe_produced_in_hbs,
+	sv_xe_in_grain,
+	sv_xe_in_grain_hbs,
+	sv_xe_in_intragranular_solution,
+	sv_xe_in_intragranular_bubbles,
+	sv_xe_at_grain_boundary,
+	sv_xe_released,
+	sv_xe_decayed,
+	sv_kr_produced,
+	sv_kr_in_grain,
+	sv_kr_in_intragranular_solution,
+	sv_kr_in_intragranular_bubbles,
+	sv_kr_at_grain_boundary,
+	sv_kr_released,
+	sv_kr_decayed,
+	sv_fission_gas_release,
+	sv_he_produced,
+	sv_he_in_grain,
+	sv_he_in_intragranular_solution,
+	sv_he_in_intragranular_bubbles,
+	sv_he_at_grain_boundary,
+	sv_he_released,
+	sv_he_decayed,
+	sv_he_fractional_release,
+	sv_he_release_rate,
+	sv_xe133_produced,
+	sv_xe133_in_grain,
+	sv_xe133_in_intragranular_solution,
+	sv_xe133_in_intragranular_bubbles,
+	sv_xe133_decayed,
+	sv_xe133_at_grain_boundary,
+	sv_xe133_released,
+	sv_xe133_r_b,
+	sv_kr85m_produced,
+	sv_kr85m_in_grain,
+	sv_kr85m_in_intragranular_solution,
+	sv_kr85m_in_intragranular_bubbles,
+	sv_kr85m_decayed,
+	sv_kr85m_at_grain_boundary,
+	sv_kr85m_released,
+	sv_kr85m_r_b,
+	sv_intragranular_bubble_concentration,
+	sv_intragranular_bubble_radius,
+	sv_intragranular_bubble_volume,
+	sv_intragranular_xe_atoms_per_bubble,
+	sv_intragranular_kr_atoms_per_bubble,
+	sv_intragranular_he_atoms_per_bubble,
+	sv_intragranular_atoms_per_bubble,
+	sv_intragranular_gas_bubble_swelling,
+	sv_intragranular_gas_solution_swelling,
+	sv_intergranular_bubble_concentration,
+	sv_intergranular_xe_atoms_per_bubble,
+	sv_intergranular_kr_atoms_per_bubble,
+	sv_intergranular_he_atoms_per_bubble,
+	sv_intergranular_atoms_per_bubble,
+	sv_intergranular_vacancies_per_bubble,
+	sv_intergranular_bubble_pressure,
+	sv_critical_intergranular_bubble_pressure,
+	sv_intergranular_bubble_radius,
+	sv_intergranular_bubble_area,
+	sv_intergranular_bubble_volume,
+	sv_intergranular_fractional_coverage,
+	sv_intergranular_saturation_fractional_coverage,
+	sv_intergranular_gas_swelling,
+	sv_intergranular_fractional_intactness,
+	sv_burnup,
+	sv_fima,
+	sv_effective_burnup,
+	sv_irradiation_time,
+	sv_fuel_density,
+	sv_u_duplicate,
+	sv_u234,
+	sv_u235,
+	sv_u236,
+	sv_u237,
+	sv_u238,
+	sv_u,
+	sv_intergranular_vented_fraction,
+	sv_intergranular_venting_probability,
+	sv_restructured_volume_fraction,
+	sv_intragranular_similarity_ratio,
+	sv_specific_power_duplicate,
+	sv_gap_oxygen_partial_pressure,
+	sv_stoichiometry_deviation,
+	sv_equilibrium_stoichiometry_deviation,
+	sv_fuel_oxygen_partial_pressure,
+	sv_fuel_oxygen_potential,
+	sv_specific_power,
+	sv_hbs_porosity,
+	sv_hbs_pore_density,
+	sv_hbs_pore_volume,
+	sv_hbs_pore_radius,
+	sv_xe_in_hbs_pores,
+	sv_xe_in_hbs_pores_variance,
+	sv_xe_atoms_per_hbs_pore,
+	sv_xe_atoms_per_hbs_pore_variance,
+	sv_grain_growth_newton_root,
+	sv_uo2_thermochemistry_newton_root,
+	sv_stoichiometry_deviation_newton_root,
+	n_sciantix_variables
+};
+
+extern thread_local NameMap sv;
 
 void MapSciantixVariable();
 
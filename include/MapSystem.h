@@ -17,13 +17,19 @@
 #ifndef MAP_SYSTEM_H
 #define MAP_SYSTEM_H
 
-#include <map>
+#include "NameMap.h"
 #include <string>
 #include "SystemDeclaration.h"
 
-extern std::map<std::string, int> sy;
+extern thread_local NameMap sy;
+
+/// Handles of the systems, set by their definitions
+extern thread_local int sy_xe_in_uo2;
+extern thread_local int sy_xe_in_uo2hbs;
 
 void MapSystem();
 
+void ResetSystemHandles();
+
 #endif // MAP_SYSTEM_H
 
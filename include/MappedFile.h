@@ -0,0 +1,55 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/// MappedFile
+/// Read-only memory mapping of a whole file (POSIX mmap; on Windows the file is read in memory).
+class MappedFile
+{
+protected:
+	const char* data;
+	std::size_t size;
+	void* mapping;
+
+public:
+	/// Maps the file, returns false if it does not exist. Sequential = the file is read front to back
+	bool open(const std::string& name, bool sequential);
+
+	void close();
+
+	const char* getData() const
+	{
+		return data;
+	}
+
+	std::size_t getSize() const
+	{
+		return size;
+	}
+
+	MappedFile();
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif // MAPPED_FILE_H
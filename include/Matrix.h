@@ -18,220 +18,221 @@
 #define MATRIX_H
 
 #include "Material.h"
+#include "Real.h"
 
 /// Class for the (fuel) matrix material (e.g., UO2, UO2-HBS, MOX), derived from the class Material
 class Matrix : virtual public Material
 {
 protected:
-	double matrix_density;
-	double lattice_parameter;
-	double grain_boundary_mobility;
-	double ff_range;
-	double ff_influence_radius;
-	double surface_tension;
-	double schottky_defect_volume;
-	double ois_volume;
-	double grain_boundary_thickness;
-	double grain_boundary_diffusivity;
-	double semidihedral_angle;
-	double lenticular_shape_factor;
-	double grain_radius;
-	double healing_temperature_threshold;
-	double nucleation_rate;
-	double pore_nucleation_rate;
-	double pore_resolution_rate;
-	double pore_trapping_rate;
+	Real matrix_density;
+	Real lattice_parameter;
+	Real grain_boundary_mobility;
+	Real ff_range;
+	Real ff_influence_radius;
+	Real surface_tension;
+	Real schottky_defect_volume;
+	Real ois_volume;
+	Real grain_boundary_thickness;
+	Real grain_boundary_diffusivity;
+	Real semidihedral_angle;
+	Real lenticular_shape_factor;
+	Real grain_radius;
+	Real healing_temperature_threshold;
+	Real nucleation_rate;
+	Real pore_nucleation_rate;
+	Real pore_resolution_rate;
+	Real pore_trapping_rate;
 	std::string matrix_name;
 
 public:
 	
-	void setTheoreticalDensity(double m)
+	void setTheoreticalDensity(Real m)
 	{
 		/// Member function to set the matrix theoretical density (kg/m3)
 		matrix_density = m;
 	}
 
-	double getTheoreticalDensity()
+	Real getTheoreticalDensity()
 	{
 		/// Member function to get the matrix theoretical density (kg/m3)
 		return matrix_density;
 	}
 
-	void setLatticeParameter(double m)
+	void setLatticeParameter(Real m)
 	{
 		/// Member function to set the matrix lattice parameter
 		lattice_parameter = m;
 	}
 
-	double getLatticeParameter()
+	Real getLatticeParameter()
 	{
 		/// Member function to get the matrix lattice parameter
 		return lattice_parameter;
 	}
 
 
-	void setSurfaceTension(double r)
+	void setSurfaceTension(Real r)
 	{
 		/// Member function to set the surface tension of the matrix material (N/m)
 		surface_tension = r;
 	}
 
-	double getSurfaceTension()
+	Real getSurfaceTension()
 	{
 		/// Member function to get the surface tension of the matrix material (N/m)
 		return surface_tension;
 	}
 
-	void setSchottkyVolume(double v)
+	void setSchottkyVolume(Real v)
 	{
 		/// Member function to set the volume of a Schottky volume in the matrix (m3).
 		schottky_defect_volume = v;
 	}
 
-	double getSchottkyVolume()
+	Real getSchottkyVolume()
 	{
 		/// Member function to get the volume of a Schottky volume in the matrix (m3).
 		return schottky_defect_volume;
 	}
 
-	void setOIS(double v)
+	void setOIS(Real v)
 	{
 		/// Member function to set the volume of an octahedral interstitial site (OIS) (m3).
 		ois_volume = v;
 	}
 
-	double getOIS()
+	Real getOIS()
 	{
 		/// Member function to get the volume of an octahedral interstitial site (OIS) (m3).
 		return ois_volume;
 	}
 
 	void setGrainBoundaryMobility(int input_value);
-	double getGrainBoundaryMobility()
+	Real getGrainBoundaryMobility()
 	{
 		/// Member function to get the mobility of the grain boundaries of the matrix.
 		return grain_boundary_mobility;
 	}
 
-	void setFFrange(double r)
+	void setFFrange(Real r)
 	{
 		/// Member function to set the (average) range of the fission fragments in the matrix (m).
 		ff_range = r;
 	}
 
-	double getFFrange()
+	Real getFFrange()
 	{
 		/// Member function to get the (average) range of the fission fragments in the matrix (m).
 		return ff_range;
 	}
 
-	void setFFinfluenceRadius(double r)
+	void setFFinfluenceRadius(Real r)
 	{
 		/// Member function to set the radius of influence of the fission fragment track (m).
 		ff_influence_radius = r;
 	}
 
-	double getFFinfluenceRadius()
+	Real getFFinfluenceRadius()
 	{
 		/// Member function to get the radius of influence of the fission fragment track (m).
 		return ff_influence_radius;
 	}
 
-	void setSemidihedralAngle(double sda)
+	void setSemidihedralAngle(Real sda)
 	{
 		/// Member function to set the semidihedral angle.
 		semidihedral_angle = sda;
 	}
 
-	double getSemidihedralAngle()
+	Real getSemidihedralAngle()
 	{
 		/// Member function to get the semidihedral angle.
 		return semidihedral_angle;
 	}
 
-	void setGrainBoundaryThickness(double gbt)
+	void setGrainBoundaryThickness(Real gbt)
 	{
 		/// Member function to set the grain-boundary thickness (m)
 		grain_boundary_thickness = gbt;
 	}
 
-	double getGrainBoundaryThickness()
+	Real getGrainBoundaryThickness()
 	{
 		/// Member function to get the grain-boundary thickness (m)
 		return grain_boundary_thickness;
 	}
 
 	void setGrainBoundaryVacancyDiffusivity(int input_value);
-	double getGrainBoundaryVacancyDiffusivity()
+	Real getGrainBoundaryVacancyDiffusivity()
 	{
 		/// Member function to get the grain-boundary vacancy diffusivity.
 		return grain_boundary_diffusivity;
 	}
 
-	void setLenticularShapeFactor(double lsf)
+	void setLenticularShapeFactor(Real lsf)
 	{
 		/// Member function to set the lenticular shape factor (/).
 		lenticular_shape_factor = lsf;
 	}
 
-	double getLenticularShapeFactor()
+	Real getLenticularShapeFactor()
 	{
 		/// Member function to get the lenticular shape factor (/).
 		return lenticular_shape_factor;
 	}
 
-	void setNucleationRate(double n)
+	void setNucleationRate(Real n)
 	{
 		/// Member function to set the nucleation rate of the matrix under irradiation (1/s).
 		nucleation_rate = n;
 	}
 
-	double getNucleationRate()
+	Real getNucleationRate()
 	{
 		/// Member function to get the nucleation rate of the matrix under irradiation (1/s).
 		return nucleation_rate;
 	}
 
 	void setPoreNucleationRate();
-	double getPoreNucleationRate()
+	Real getPoreNucleationRate()
 	{
 		/// Member function to get the pore nucleation rate of the matrix.
 		return pore_nucleation_rate;
 	}
 
 	void setPoreResolutionRate();
-	double getPoreResolutionRate()
+	Real getPoreResolutionRate()
 	{
 		/// Member function to get the pore resolution rate of the matrix.
 		return pore_resolution_rate;
 	}
 
 	void setPoreTrappingRate();
-	double getPoreTrappingRate()
+	Real getPoreTrappingRate()
 	{
 		/// Member function to get the pore trapping rate of the matrix.
 		return pore_trapping_rate;
 	}
 
-	void setGrainRadius(double gr)
+	void setGrainRadius(Real gr)
 	{
 		/// Member function to set the grain radius of the matrix.
 		grain_radius = gr;
 	}
 
-	double getGrainRadius()
+	Real getGrainRadius()
 	{
 		/// Member function to get the grain radius of the matrix.
 		return grain_radius;
 	}
 
-	void setHealingTemperatureThreshold(double t)
+	void setHealingTemperatureThreshold(Real t)
 	{
 		/// Member function to set the (estimated) temperature limit for complete healing of the extended defects in the fuel matrix (K).
 		healing_temperature_threshold = t;
 	}
 
-	double getHealingTemperatureThreshold()
+	Real getHealingTemperatureThreshold()
 	{
 		/// Member function to get the (estimated) temperature limit for complete healing of the extended defects in the fuel matrix (K).
 		return healing_temperature_threshold;
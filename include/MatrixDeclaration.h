@@ -18,9 +18,10 @@
 #define MATRIX_DECLARATION_H
 
 #include <vector>
+#include "Registry.h"
 #include "Matrix.h"
 
-extern std::vector<Matrix> matrix;
+extern thread_local Registry<Matrix> matrix;
 
 #endif // MATRIX_DECLARATION_H
 
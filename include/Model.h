@@ -36,16 +36,16 @@ class Model : public HistoryVariable, public SciantixVariable, public InputVaria
 {
 protected:
 	std::string overview;
-	std::vector<double> parameter;
+	std::vector<Real> parameter;
 
 public:
 
-	void setParameter(std::vector<double> p)
+	void setParameter(std::vector<Real> p)
 	{
 		parameter = p;
 	}
 
-	std::vector<double> getParameter()
+	const std::vector<Real>& getParameter() const
 	{
 		return parameter;
 	}
@@ -18,8 +18,9 @@
 #define MODEL_DECLARATION_H
 
 #include <vector>
+#include "Registry.h"
 #include "Model.h"
 
-extern std::vector<Model> model;
+extern thread_local Registry<Model> model;
 
 #endif // MODEL_DECLARATION_H
@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef NAME_MAP_H
+#define NAME_MAP_H
+
+#include <map>
+#include <string>
+
+/// NameMap
+/// Map from the names of the objects (variables, models, gases, matrices, systems) to their handles.
+/// The objects are addressed by handles during the time step: the maps are only used when the objects
+/// are defined for the first time. The lookups are counted, to check it (see utilities/benchmark).
+
+class NameMap : public std::map<std::string, int>
+{
+public:
+	/// Number of lookups by name performed by this thread
+	static thread_local long long lookups;
+
+	int& operator[](const std::string& name)
+	{
+		++lookups;
+		return std::map<std::string, int>::operator[](name);
+	}
+
+	iterator find(const std::string& name)
+	{
+		++lookups;
+		return std::map<std::string, int>::find(name);
+	}
+
+	std::pair<iterator, bool> emplace(const std::string& name, int handle)
+	{
+		++lookups;
+		return std::map<std::string, int>::emplace(name, handle);
+	}
+};
+
+#endif // NAME_MAP_H
@@ -0,0 +1,248 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEWTON_SOLVER_H
+#define NEWTON_SOLVER_H
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "Real.h"
+#include "Tracing.h"
+
+/// NewtonSolver
+/// Newton iterations x_k+1 = x_k - f(x_k) / f'(x_k), on a residual f and its derivative f' given as functors.
+/// The convergence test is a functor on the residual (e.g., AbsoluteResidual), checked at each iterate: the root is the
+/// iterate after the step of the converged residual. With a bracket (NewtonSettings(max_iterations, lower, upper)) the
+/// iterations are safeguarded: a step leaving the bracket is halved towards the violated bound, so the iterates stay
+/// where the residual is defined.
+/// The iterations are on the scalar type S of the caller (Real, see Real.h), so the root carries its derivatives.
+
+/// Iteration cap and (optional) bracket of the root
+struct NewtonSettings
+{
+	int max_iterations;
+	bool safeguarded;
+	double lower;
+	double upper;
+
+	explicit NewtonSettings(int max_iterations) :
+		max_iterations(max_iterations), safeguarded(false), lower(0.0), upper(0.0) { }
+
+	NewtonSettings(int max_iterations, double lower, double upper) :
+		max_iterations(max_iterations), safeguarded(true), lower(lower), upper(upper) { }
+};
+
+template <class S>
+struct NewtonResult
+{
+	S root;
+	S residual; // at the last iterate tested
+	int iterations;
+	bool converged;
+};
+
+/// Convergence test |f| < tolerance
+struct AbsoluteResidual
+{
+	double tolerance;
+
+	explicit AbsoluteResidual(double tolerance) : tolerance(tolerance) { }
+
+	template <class S>
+	bool operator()(const S& residual) const
+	{
+		return fabs(residual) < tolerance;
+	}
+};
+
+/// Convergence test |int(f)| < tolerance (abs of the integer part, as the C abs of the former solvers):
+/// with tolerance < 1 the iterations stop at |f| < 1. The same test on the value in the Dual build
+struct IntegerResidual
+{
+	double tolerance;
+
+	explicit IntegerResidual(double tolerance) : tolerance(tolerance) { }
+
+	template <class S>
+	bool operator()(const S& residual) const
+	{
+		return std::abs(int(Value(residual))) < tolerance;
+	}
+};
+
+/// Newton step from x, kept inside the bracket of the settings (also when f' = 0 makes it NaN)
+template <class S>
+inline S NewtonStep(const S& x, const S& residual, const S& derivative, const NewtonSettings& settings)
+{
+	S next = x - residual / derivative;
+
+	if (settings.safeguarded)
+	{
+		if (!(next >= settings.lower))
+			next = 0.5 * (x + settings.lower);
+		else if (next > settings.upper)
+			next = 0.5 * (x + settings.upper);
+	}
+
+	return next;
+}
+
+/// Newton iterations from the first guess x: residual(x) and derivative(x) return f(x) and f'(x)
+template <class S, class Residual, class Derivative, class Converged>
+NewtonResult<S> Newton(S x, const Residual& residual, const Derivative& derivative, const Converged& converged,
+	const NewtonSettings& settings)
+{
+	NewtonResult<S> result;
+	result.root = x;
+	result.residual = 0.0;
+	result.iterations = 0;
+	result.converged = false;
+
+	for (int iteration = 0; iteration < settings.max_iterations; ++iteration)
+	{
+		const S f = residual(x);
+		const S df = derivative(x);
+		x = NewtonStep(x, f, df, settings);
+
+		result.root = x;
+		result.residual = f;
+		result.iterations = iteration + 1;
+
+		if (converged(f))
+		{
+			result.converged = true;
+			break;
+		}
+	}
+
+	return result;
+}
+
+/// Iterations and final residual of a solver call, in its event (iTrace = 1)
+template <class S>
+inline void TraceNewton(TraceScope& trace, const NewtonResult<S>& result)
+{
+	trace.setIterations(result.iterations);
+	trace.setResidual(Value(result.residual));
+}
+
+/// NewtonWarmStart
+/// Last converged root of a sequence of equations (e.g., the same equation at the next time step), as first guess.
+/// The root belongs to the state of the caller, e.g., of a node (iNewtonWarmStart, see Simulation): the warm start is built from it
+/// and getRoot returns it updated. A zero root stands for none yet, so the roots of the equations are expected to be non-zero.
+template <class S>
+class NewtonWarmStart
+{
+protected:
+	S root;
+
+public:
+	/// The last converged root, or the fallback before the first one
+	S guess(const S& fallback) const
+	{
+		return (root != 0.0) ? root : fallback;
+	}
+
+	void update(const NewtonResult<S>& result)
+	{
+		update(result.root, result.converged);
+	}
+
+	/// With the root of a lane of NewtonBatch
+	void update(const S& lane_root, bool converged)
+	{
+		if (converged)
+			root = lane_root;
+	}
+
+	void reset()
+	{
+		root = 0.0;
+	}
+
+	S getRoot() const
+	{
+		return root;
+	}
+
+	explicit NewtonWarmStart(const S& root = S(0.0)) : root(root) { }
+	~NewtonWarmStart() { }
+};
+
+/// Iterations and final residual of each lane of a NewtonBatch call
+struct NewtonBatchStatistics
+{
+	std::vector<int> iterations;
+	std::vector<double> residual;
+	int converged_lanes;
+	int max_iterations; // of a lane
+	long long total_iterations;
+};
+
+/// Newton iterations on count independent equations (e.g., the same model on many nodes), in lockstep:
+/// residual(i, x) and derivative(i, x) are f and f' of the lane i. A converged lane is masked, its root and statistics
+/// do not change any more, but the sweep over the lanes stays dense (no gather of the active ones) so that it can be
+/// vectorized when the functors are inlined. Each lane goes through the operations of Newton, the roots are the same.
+/// x: first guesses (e.g., the roots of the previous call, as warm start), overwritten by the roots. A lane has converged if the
+/// convergence test holds on its final residual (statistics.residual).
+/// Used by the time step of the batches, across the nodes of a block (see SimulationBlock).
+template <class Residual, class Derivative, class Converged>
+void NewtonBatch(int count, double x[], const Residual& residual, const Derivative& derivative, const Converged& converged,
+	const NewtonSettings& settings, NewtonBatchStatistics& statistics)
+{
+	TraceScope trace("Solver::NewtonBatch", "solver");
+
+	statistics.iterations.assign(count, 0);
+	statistics.residual.assign(count, 0.0);
+
+	std::vector<char> active(count, 1);
+	int active_lanes(count), iteration(0);
+
+	for (; iteration < settings.max_iterations && active_lanes > 0; ++iteration)
+	{
+		active_lanes = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			const double f = residual(i, x[i]);
+			const double df = derivative(i, x[i]);
+			const double next = NewtonStep(x[i], f, df, settings);
+
+			const bool lane = active[i];
+			x[i] = lane ? next : x[i];
+			statistics.residual[i] = lane ? f : statistics.residual[i];
+			statistics.iterations[i] += lane;
+
+			active[i] = lane && !converged(f);
+			active_lanes += active[i];
+		}
+	}
+
+	statistics.converged_lanes = count - active_lanes;
+	statistics.max_iterations = iteration;
+	statistics.total_iterations = 0;
+	double max_residual(0.0);
+	for (int i = 0; i < count; ++i)
+	{
+		statistics.total_iterations += statistics.iterations[i];
+		max_residual = std::fmax(max_residual, std::fabs(statistics.residual[i]));
+	}
+
+	trace.setIterations(iteration);
+	trace.setResidual(max_residual);
+}
+
+#endif // NEWTON_SOLVER_H
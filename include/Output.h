@@ -34,7 +34,21 @@
 #include "MapHistoryVariable.h"
 #include "MapInputVariable.h"
 #include "MatrixDeclaration.h"
+#include "MainVariables.h"
+#include "ErrorMessages.h"
+#include "OutputSink.h"
+#include "ColumnarOutput.h"
+#include "AsyncOutput.h"
 
 void Output();
 
+/// Marks the time step of the next Output as the one reaching a point of the input history (iOutputAtHistoryPoints)
+void SetOutputHistoryPoint(bool reached);
+
+/// Writes the rows of output.txt (or output.bin) still in the buffer (at the end of the simulation)
+void FlushOutput();
+
+/// Writes the rows still in the buffer and closes output.txt (or output.bin), e.g., before the next case of a batch
+void CloseOutput();
+
 #endif // OUTPUT_H
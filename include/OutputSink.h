@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/// OutputSink
+/// Output file that stays open for the whole simulation (opened in append mode, as Output did at every time step).
+/// The rows are formatted in a user-space buffer, with std::to_chars, and written to the file in large blocks.
+/// The numbers are formatted as std::ostream << std::setprecision(precision) << value, so that the file is
+/// byte by byte the one written with iostreams.
+
+class OutputSink
+{
+protected:
+	std::string name;
+	std::FILE* file;
+	std::vector<char> buffer;
+	std::size_t used;
+
+	void reserve(std::size_t length)
+	{
+		if (used + length > buffer.size())
+			flush();
+	}
+
+public:
+	/// Opens the file, if not already open
+	bool open();
+
+	/// Sets the name of the file, closing the one open with another name
+	void setName(const std::string& file_name);
+
+	bool isOpen() const
+	{
+		return file != nullptr;
+	}
+
+	void write(const char* text, std::size_t length);
+
+	void write(const std::string& text)
+	{
+		write(text.data(), text.size());
+	}
+
+	void write(char c)
+	{
+		reserve(1);
+		buffer[used++] = c;
+	}
+
+	/// Writes value in the general format with the given significant digits (%.*g)
+	void write(double value, int precision);
+
+	/// Writes the buffer to the file (opening it, if needed)
+	void flush();
+
+	/// Flushes and closes the file
+	void close();
+
+	OutputSink(const std::string& name, std::size_t buffer_size = 1 << 20);
+	~OutputSink();
+
+	OutputSink(const OutputSink&) = delete;
+	OutputSink& operator=(const OutputSink&) = delete;
+};
+
+#endif // OUTPUT_SINK_H
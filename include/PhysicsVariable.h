@@ -18,6 +18,7 @@
 #define PHYSICS_VARIABLE_H
 
 #include "Variable.h"
+#include "Real.h"
 
 /// Derived class inherited by Variable
 
@@ -25,24 +26,24 @@ class PhysicsVariable : virtual public Variable
 {
 protected:
 	std::string uom;
-	double final_value;
-	double initial_value;
+	Real final_value;
+	Real initial_value;
 	bool to_output;
 
 public:
-	void rescaleInitialValue(const double factor)
+	void rescaleInitialValue(const Real factor)
 	{
 		// Function to rescale the final value
 		initial_value *= factor;
 	}
 
-	void rescaleFinalValue(const double factor)
+	void rescaleFinalValue(const Real factor)
 	{
 		// Function to rescale the final value
 		final_value *= factor;
 	}
 
-	void addValue(const double v)
+	void addValue(const Real v)
 	{
 		// Function to increase final_value by v
 		final_value += v;
@@ -68,27 +69,27 @@ public:
 		initial_value = final_value;
 	}
 
-	void setFinalValue(double FinalValue)
+	void setFinalValue(Real FinalValue)
 	{
 		final_value = FinalValue;
 	}
 
-	void setInitialValue(double InitialValue)
+	void setInitialValue(Real InitialValue)
 	{
 		initial_value = InitialValue;
 	}
 
-	double getFinalValue()
+	Real getFinalValue()
 	{
 		return final_value;
 	}
 
-	double getInitialValue()
+	Real getInitialValue()
 	{
 		return initial_value;
 	}
 
-	double getIncrement()
+	Real getIncrement()
 	{
 		return final_value - initial_value;
 	}
@@ -22,7 +22,7 @@
 
 /// PhysicsVariableDeclaration.h
 
-extern std::vector<PhysicsVariable> physics_variable;
+extern thread_local std::vector<PhysicsVariable> physics_variable;
 
 #endif // PHYSICS_VARIABLE_DECLARATION_H
 
@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+#include <chrono>
+#include <ostream>
+
+/// Profiling of the stages of a SCIANTIX time step (iProfiling = 1)
+/// For every stage of Sciantix() (variables and systems definition, each model with its solution, output)
+/// the wall time, the number of calls and the number (and bytes) of memory allocations are accumulated.
+/// The profile is per thread, it is written at the end of the simulation as a table (profile.txt) and as JSON (profile.json).
+/// The allocations are counted by a replacement of the global operator new, compiled only with SCIANTIX_ALLOCATION_COUNT
+/// (cmake -DSCIANTIX_ALLOCATION_COUNT=ON, make ALLOCATION_COUNT=1): otherwise the allocations of the profile are 0.
+/// With iProfiling = 0 each stage costs a single branch.
+
+enum ProfileStage
+{
+	ps_set_variables,
+	ps_set_gas,
+	ps_set_matrix,
+	ps_set_system,
+	ps_burnup,
+	ps_effective_burnup,
+	ps_environment_composition,
+	ps_uo2_thermochemistry,
+	ps_stoichiometry_deviation,
+	ps_high_burnup_structure_formation,
+	ps_high_burnup_structure_porosity,
+	ps_grain_growth,
+	ps_grain_boundary_sweeping,
+	ps_gas_production,
+	ps_gas_decay,
+	ps_intragranular_bubble_behaviour,
+	ps_gas_diffusion,
+	ps_grain_boundary_micro_cracking,
+	ps_grain_boundary_venting,
+	ps_intergranular_bubble_behaviour,
+	ps_map_model,
+	ps_figures_of_merit,
+	ps_update_variables,
+	ps_output,
+	n_profile_stages
+};
+
+/// Accumulated profile of a stage
+struct StageProfile
+{
+	double time; // (s)
+	long long calls;
+	long long allocations;
+	long long allocated_bytes;
+};
+
+/// Number of diffusion modes advanced by the spectral solvers of this thread, summed over their solutions
+/// (iDiffusionModes, iAdaptiveModes): the average number of active modes is reported with the profile
+struct DiffusionModesProfile
+{
+	long long solutions;
+	long long active_modes;
+	long long modes;
+};
+
+/// Number and bytes of the memory allocations of this thread
+long long AllocationCount();
+long long AllocatedBytes();
+
+/// Profile of the stages of this thread
+const StageProfile* GetProfile();
+const char* ProfileStageName(int stage);
+const DiffusionModesProfile& GetDiffusionModesProfile();
+void ResetProfile();
+
+/// One solution of the spectral solvers, advancing active_modes of its n_modes
+void CountDiffusionModes(int active_modes, int n_modes);
+
+/// ProfileTimer
+/// Laps of the stages of a time step: lap(stage) assigns to the stage the time and the allocations since the previous lap
+/// (profiling) and records the stage as an event (tracing, see Tracing.h).
+class ProfileTimer
+{
+protected:
+	bool profiling;
+	bool tracing;
+	bool enabled;
+	std::chrono::steady_clock::time_point last;
+	long long last_allocations;
+	long long last_allocated_bytes;
+
+	void record(ProfileStage stage);
+
+public:
+	void lap(ProfileStage stage)
+	{
+		if (enabled)
+			record(stage);
+	}
+
+	ProfileTimer(bool profiling, bool tracing);
+	~ProfileTimer() { }
+};
+
+/// Table of the profile: stage, calls, time, time per call, fraction of the total, allocations; average number of active modes
+void WriteProfile(std::ostream& stream);
+
+/// Profile as JSON: {"stages": [{"name", "calls", "time_s", "allocations", "allocated_bytes"}, ...], "total_time_s",
+/// "diffusion_modes": {"solutions", "average_active_modes", "average_modes"}}
+void WriteProfileJSON(std::ostream& stream);
+
+#endif // PROFILING_H
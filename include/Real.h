@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef REAL_H
+#define REAL_H
+
+#include "Dual.h"
+
+/// Real
+/// Scalar type of the physics computed by SCIANTIX (variables, material properties, model parameters, solvers).
+/// It is double in the standard build. Building with -DSCIANTIX_TANGENT_DIRECTIONS=K (e.g., the sciantix_tangent target)
+/// makes it Dual<K>: each time step then propagates, with every quantity, its exact derivatives along K directions,
+/// seeded on the scaling factors or on the history of the time step (see SciantixTangents).
+
+#ifdef SCIANTIX_TANGENT_DIRECTIONS
+typedef Dual<SCIANTIX_TANGENT_DIRECTIONS> Real;
+const int n_tangent_directions = SCIANTIX_TANGENT_DIRECTIONS;
+#else
+typedef double Real;
+const int n_tangent_directions = 0;
+#endif
+
+#endif // REAL_H
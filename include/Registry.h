@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include <vector>
+
+/// Registry
+/// Vector of the objects (models, matrices, systems) defined at every time step, always in the same order.
+/// Instead of emplacing new objects in a vector cleared at the end of each time step, the objects
+/// of the previous time step are redefined, reusing their memory (names, references, parameters).
+/// The reference is cleared, since the definitions append to it.
+
+template <class T>
+class Registry : public std::vector<T>
+{
+protected:
+	int defined = 0;
+
+public:
+	/// Returns the index of the next object defined in the current time step
+	int define()
+	{
+		if (defined < int(this->size()))
+			(*this)[defined].setRef("");
+		else
+			this->emplace_back();
+
+		return defined++;
+	}
+
+	/// Starts a new time step, in which the same objects are defined again
+	void rewind()
+	{
+		defined = 0;
+	}
+
+	/// Removes all the objects (e.g., when the input settings change, so that the definitions change)
+	void clear()
+	{
+		std::vector<T>::clear();
+		defined = 0;
+	}
+};
+
+#endif // REGISTRY_H
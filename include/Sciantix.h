@@ -14,9 +14,11 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include "SetVariables.h"
 #include "MaterialDeclaration.h"
@@ -28,5 +30,32 @@
 #include "Output.h"
 #include "Simulation.h"
 #include "FiguresOfMerit.h"
+#include "SciantixContext.h"
+#include "SciantixResults.h"
+#include "Profiling.h"
+#include "Tracing.h"
+#include "SciantixBatch.h"
+#include "SimulationBlock.h"
 
 void Sciantix(int Sciantix_options[], double Sciantix_history[], double Sciantix_variables[], double Sciantix_scaling_factors[], double Sciantix_diffusion_modes[]);
+
+/// Advances by one time step the node whose state is owned by the context.
+/// Reentrant: different contexts can be advanced at the same time from different threads.
+void Sciantix(SciantixContext& context);
+
+/// Advances by one time step all the nodes of the batch, with the arithmetic stages computed across the nodes (see SciantixBatch).
+/// The registries of models, matrices and systems (shared input settings) are defined once and reused at every time step.
+void Sciantix(SciantixBatch& batch);
+
+/// As Sciantix(SciantixBatch&), with the state of the nodes stored in single precision
+void Sciantix(SciantixBatchMixed& batch);
+
+#ifdef SCIANTIX_TANGENT_DIRECTIONS
+/// Advances by one time step the node of the context, as Sciantix(context), together with the derivatives of its state at the
+/// end of the time step with respect to the temperature and the fission rate at the end of the time step (history[1], history[3]),
+/// the state at the beginning of the time step being given (e.g., the consistent tangent for the coupling with a fuel performance code):
+/// jacobian[i][0] = d variables[i] / d T, jacobian[i][1] = d variables[i] / d F. The derivatives are exact (Dual numbers, see Real.h).
+/// The tangents of the context, if any (context.tangents), are overwritten (directions 0 and 1 seeded on history[1] and history[3],
+/// the others zero).
+void SciantixStepJacobian(SciantixContext& context, double jacobian[][2]);
+#endif
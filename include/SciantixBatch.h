@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_BATCH_H
+#define SCIANTIX_BATCH_H
+
+#include <vector>
+#include "SciantixContext.h"
+
+/// SciantixBatchOf
+/// This class owns the state of a batch of SCIANTIX nodes sharing the same input settings (e.g., the nodes of a fuel rod),
+/// advanced by one time step with a single call to Sciantix(batch).
+/// The node arrays (history, variables, scaling factors, diffusion modes) are stored as structure of arrays:
+/// each entry is contiguous over the nodes, e.g., variables(38)[node] is the burnup of the node.
+/// The diffusion modes of the nodes, most of their state, are stored as State; the history, the variables and the scaling factors
+/// in double precision. The time step is computed in double precision, in blocks of SpectralDiffusionKernel::batch_nodes nodes:
+/// the stages of each node (definitions of the models, SetVariables, UpdateVariables, micro-cracking, ...) run node by node on a copy
+/// of the node (SciantixContext) without its modes, the arithmetic of burnup, effective burnup, UO2 thermochemistry, stoichiometry deviation,
+/// grain growth (the Newton solvers of the nodes in NewtonBatch), intra- and intergranular bubbles, gas produced and decayed, sweeping and spectral diffusion across the nodes of the block (SimulationBlock), the modes in the
+/// batch arrays. The node stages take most of the time step, so the batch is about as fast as the nodes advanced one by one.
+/// The results are bitwise identical to the ones of Sciantix(context), node by node (utilities/benchmark/BatchBenchmark.C).
+/// The settings without a vectorized solution (iDiffusionSolver > 1, iDiffusionIntegrator, iAdaptiveModes) and the time steps
+/// profiled or traced are computed node by node.
+
+template <class State>
+class SciantixBatchOf
+{
+protected:
+	int n_nodes;
+	std::vector<double> history_array;
+	std::vector<double> variables_array;
+	std::vector<double> scaling_factors_array;
+	std::vector<State> diffusion_modes_array;
+
+public:
+	/// Input settings, shared by all the nodes
+	int options[40] = {};
+
+	/// If true, every node writes output.txt and overview.txt, as Sciantix(int[], double[], ...)
+	bool write_output = false;
+
+	/// If not null, array of size() results, one per node, where the output of the nodes is stored (see SciantixResults)
+	SciantixResults* results = nullptr;
+
+	int size() const
+	{
+		return n_nodes;
+	}
+
+	/// Entry k of Sciantix_history of all the nodes
+	double* history(int k)
+	{
+		return &history_array[k * n_nodes];
+	}
+
+	/// Entry k of Sciantix_variables of all the nodes
+	double* variables(int k)
+	{
+		return &variables_array[k * n_nodes];
+	}
+
+	/// Entry k of Sciantix_scaling_factors of all the nodes
+	double* scaling_factors(int k)
+	{
+		return &scaling_factors_array[k * n_nodes];
+	}
+
+	/// Entry k of Sciantix_diffusion_modes of all the nodes
+	State* diffusion_modes(int k)
+	{
+		return &diffusion_modes_array[k * n_nodes];
+	}
+
+	/// Copies the state of the nodes [first, first + count) to the contexts (without the diffusion modes, if not diffusion_modes)
+	void getNodes(int first, int count, SciantixContext contexts[], bool diffusion_modes = true);
+
+	/// Copies back the variables and the diffusion modes of the nodes [first, first + count), advanced by Sciantix
+	void setNodes(int first, int count, SciantixContext contexts[], bool diffusion_modes = true);
+
+	SciantixBatchOf(int n);
+	~SciantixBatchOf() { }
+};
+
+/// Batch with the state in double precision
+typedef SciantixBatchOf<double> SciantixBatch;
+
+/// Mixed-precision batch: the diffusion modes are stored in single precision (38% less memory than SciantixBatch),
+/// every time step is computed in double precision. The variables, among them the gas inventories of the mass balances
+/// (e.g., gas at grain boundary = produced - decayed - in grain - released), stay in double precision: in single precision,
+/// their rounding would be of the order of the increments of a time step. The nodes are advanced as with iStatePrecision = 1,
+/// whose accuracy is measured by utilities/benchmark/MixedPrecisionReport.C.
+typedef SciantixBatchOf<float> SciantixBatchMixed;
+
+#endif // SCIANTIX_BATCH_H
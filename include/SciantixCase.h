@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_CASE_H
+#define SCIANTIX_CASE_H
+
+#include <functional>
+#include <string>
+#include "SciantixContext.h"
+
+/// HistoryStep
+/// Time step of SimulateHistory, called in place of Sciantix(context) once the history of the context is set for the time step
+/// (Time_h, Time_step_number of this thread): e.g., to time Sciantix(context), to sample the state after it, or to advance
+/// other nodes over the same history.
+typedef std::function<void(SciantixContext& context)> HistoryStep;
+
+/// SimulateHistory
+/// Advances the node of the context over the whole input history read by InputReading (Input_history, Time_end_h of this thread),
+/// from Time_h = 0, with the time steps of TimeStepCalculation or adaptive time steps (iAdaptiveTimeStep > 0).
+/// The output is the one of the context (output.txt, context.results or none). Returns the number of (accepted) time steps.
+/// If step is given, it advances the context at every time step; the time steps are then the ones of TimeStepCalculation
+/// (iAdaptiveTimeStep is ignored: the adaptive time steps are computed twice and can be rejected).
+long long SimulateHistory(SciantixContext& context, const HistoryStep& step = nullptr);
+
+/// ReadSciantixCase
+/// Reads the input files of the directory (the working directory if empty) and initializes the state of the case
+/// (Sciantix_options, Sciantix_variables, ..., Input_history of this thread), from the default state.
+void ReadSciantixCase(const std::string& directory);
+
+/// RunSciantixCase
+/// Simulates one SCIANTIX case: reads the input files of the directory (InputReading), simulates the whole input history
+/// and writes output.txt, overview.txt, execution.txt (and profile.txt, profile.json if iProfiling = 1) in the same directory.
+/// The directory is the working directory if empty. The state of the case is per thread (see MainVariables.h),
+/// hence different cases can be simulated at the same time by different threads (see BatchRun.h).
+/// The trace events (iTrace = 1) are kept in memory, written by the caller (WriteTraceJSON).
+/// Returns the number of time steps.
+long long RunSciantixCase(const std::string& directory);
+
+#endif // SCIANTIX_CASE_H
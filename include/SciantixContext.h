@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_CONTEXT_H
+#define SCIANTIX_CONTEXT_H
+
+/// SciantixContext
+/// This structure owns the state of one SCIANTIX node (e.g., one radial/axial element of a fuel performance code),
+/// i.e., the same arrays passed to Sciantix(int[], double[], double[], double[], double[]).
+/// The vectors of objects built by Sciantix during a time step (variables, models, systems, maps, ...) are
+/// thread_local scratch, rebuilt from the context at every call. Hence, independent contexts can be advanced
+/// concurrently on different threads, without locks, each thread calling Sciantix(context).
+
+class SciantixResults;
+struct SciantixTangents;
+
+struct SciantixContext
+{
+	int options[40] = {};
+	double history[20] = {};
+	double variables[300] = {};
+	double scaling_factors[10] = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+	double diffusion_modes[1000] = {};
+
+	/// If false, the time step is performed without writing output.txt and overview.txt
+	/// (files in the working directory are shared among the contexts of the same process).
+	bool write_output = true;
+
+	/// If not null, the output of the time steps is stored in memory (see SciantixResults), instead of written
+	/// to output.txt and overview.txt: the node is advanced without any file access.
+	SciantixResults* results = nullptr;
+
+	/// Identifier of the node, reported in the trace events (see Tracing.h)
+	int node_id = 0;
+
+	/// If not null, the derivatives of the state advanced with it (sciantix_tangent only, see SciantixTangents).
+	/// Not owned by the context: the copies of the context share them.
+	SciantixTangents* tangents = nullptr;
+};
+
+#ifdef SCIANTIX_TANGENT_DIRECTIONS
+/// SciantixTangents
+/// Derivatives of the arrays of a SciantixContext along the SCIANTIX_TANGENT_DIRECTIONS directions of the Dual numbers
+/// (see Real.h), e.g., variables[i][k] = d variables[i] / d direction k. The caller seeds the directions (e.g.,
+/// scaling_factors[3][0] = 1 for d / d sf_diffusivity along the direction 0) and attaches them to the context
+/// (context.tangents), Sciantix(context) advances them with the state. Without them the derivatives are zero.
+/// The layout of SciantixContext is the same in every build: only sciantix_tangent defines this structure.
+/// See also SciantixStepJacobian.
+struct SciantixTangents
+{
+	static const int directions = SCIANTIX_TANGENT_DIRECTIONS;
+
+	double history[20][SCIANTIX_TANGENT_DIRECTIONS] = {};
+	double variables[300][SCIANTIX_TANGENT_DIRECTIONS] = {};
+	double scaling_factors[10][SCIANTIX_TANGENT_DIRECTIONS] = {};
+	double diffusion_modes[1000][SCIANTIX_TANGENT_DIRECTIONS] = {};
+};
+#endif
+
+#endif // SCIANTIX_CONTEXT_H
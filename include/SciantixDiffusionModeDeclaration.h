@@ -17,9 +17,10 @@
 #define SCIANTIX_DIFFUSION_MODES_DECLARATION
 
 #include <vector>
+#include "Real.h"
 
 /// SciantixDiffusionModeDeclaration
 extern const int n_modes;
-extern double modes_initial_conditions[40*40];
+extern thread_local Real modes_initial_conditions[40*40];
 
 #endif
@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_LANE_H
+#define SCIANTIX_LANE_H
+
+#include <vector>
+#include "InputVariableDeclaration.h"
+#include "HistoryVariableDeclaration.h"
+#include "SciantixVariableDeclaration.h"
+#include "PhysicsVariableDeclaration.h"
+#include "MapModel.h"
+#include "MapMatrix.h"
+#include "MapSystem.h"
+
+/// SciantixLane
+/// Registries of a node of a block of the batch (see SciantixBatchTimeStep): the stages of the node run on them, swapped with
+/// the ones of this thread (swap), and they keep the state of the node while the arithmetic stages are computed across the nodes
+/// (see SimulationBlock).
+
+struct SciantixLane
+{
+	std::vector<int> registry_options;
+	std::vector<InputVariable> input_variable;
+	std::vector<HistoryVariable> history_variable;
+	std::vector<SciantixVariable> sciantix_variable;
+	std::vector<PhysicsVariable> physics_variable;
+	Registry<Model> model;
+	Registry<Matrix> matrix;
+	Registry<System> sciantix_system;
+	NameMap sm, sma, sy;
+
+	/// Exchanges the registries with the ones of this thread
+	void swap();
+};
+
+#endif // SCIANTIX_LANE_H
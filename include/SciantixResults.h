@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_RESULTS_H
+#define SCIANTIX_RESULTS_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "ColumnarOutput.h"
+
+/// OverviewEntry
+/// Model, matrix or system of the simulation, as listed in overview.txt
+struct OverviewEntry
+{
+	std::string kind; // "Model", "Matrix", "System"
+	std::string name;
+	std::string reference;
+};
+
+/// SciantixResults
+/// In-memory output of a SCIANTIX node, for codes embedding SCIANTIX: when attached to a SciantixContext
+/// (context.results), Sciantix(context) stores here the values of the output variables at every time step,
+/// instead of writing output.txt and overview.txt, so that the simulation runs without any file access.
+/// The columns are the ones of output.txt (iOutput), or the ones listed in selected_columns. The overview
+/// (models, matrices, systems) and the input settings are stored at the first time step.
+/// Each node (context) has its own results: different nodes can be advanced on different threads.
+
+class SciantixResults
+{
+protected:
+	std::vector<OutputColumn> columns;
+	std::vector<std::vector<double>> values;
+	std::size_t rows;
+
+	/// Indexes of the columns in history_variable and sciantix_variable
+	std::vector<std::size_t> history_columns;
+	std::vector<std::size_t> sciantix_columns;
+	bool selected;
+
+	std::vector<OverviewEntry> overview;
+	std::vector<std::pair<std::string, double>> input_settings;
+
+	/// Selects the columns and stores the overview, from the variables and models of the current time step
+	void select();
+
+public:
+	/// Columns to store, by name or header ("Name (UOM)", as in output.txt); the columns of output.txt if empty
+	std::vector<std::string> selected_columns;
+
+	/// Called after each row is stored (e.g., to move the values to the caller and clear the results)
+	std::function<void(const SciantixResults&)> on_row;
+
+	/// Stores a row, the values of the output variables at the end of the current time step
+	void record();
+
+	/// Removes the rows stored, keeping the columns
+	void clearRows();
+
+	/// Removes everything: the columns are selected again at the next row
+	void clear();
+
+	std::size_t getRows() const
+	{
+		return rows;
+	}
+
+	const std::vector<OutputColumn>& getColumns() const
+	{
+		return columns;
+	}
+
+	/// Index of the column with this name, or header ("Name (UOM)", as in output.txt); -1 if not found
+	int findColumn(const std::string& name) const;
+
+	/// Values of the column, for all the rows stored (empty if the index is not valid)
+	const std::vector<double>& getColumn(int index) const;
+
+	/// Value of the column at a row
+	double getValue(int index, std::size_t row) const
+	{
+		return values[index][row];
+	}
+
+	/// Values of the variable with this name (empty if not a column)
+	const std::vector<double>& getSeries(const std::string& name) const
+	{
+		return getColumn(findColumn(name));
+	}
+
+	/// Models, matrices and systems of the simulation (overview.txt)
+	const std::vector<OverviewEntry>& getOverview() const
+	{
+		return overview;
+	}
+
+	/// Name and value of the input settings (input_check.txt, overview.txt)
+	const std::vector<std::pair<std::string, double>>& getInputSettings() const
+	{
+		return input_settings;
+	}
+
+	SciantixResults();
+	~SciantixResults() { }
+};
+
+#endif // SCIANTIX_RESULTS_H
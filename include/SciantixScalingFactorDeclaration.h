@@ -14,16 +14,27 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#ifndef SCIANTIX_SCALING_FACTOR_DECLARATION_H
+#define SCIANTIX_SCALING_FACTOR_DECLARATION_H
+
+#include "Real.h"
+
 /// SciantixScalingFactorDeclaration
 
-extern double sf_resolution_rate;
-extern double sf_trapping_rate;
-extern double sf_nucleation_rate;
-extern double sf_diffusivity;
-extern double sf_screw_parameter;
-extern double sf_span_parameter;
-extern double sf_cent_parameter;
-extern double sf_helium_production_rate;
-extern double sf_temperature;
-extern double sf_fission_rate;
-extern double sf_dummy;
+extern thread_local Real sf_resolution_rate;
+extern thread_local Real sf_trapping_rate;
+extern thread_local Real sf_nucleation_rate;
+extern thread_local Real sf_diffusivity;
+extern thread_local Real sf_screw_parameter;
+extern thread_local Real sf_span_parameter;
+extern thread_local Real sf_cent_parameter;
+extern thread_local Real sf_helium_production_rate;
+extern thread_local Real sf_temperature;
+extern thread_local Real sf_fission_rate;
+extern thread_local Real sf_dummy;
+
+/// Entries of Sciantix_scaling_factors, with their names in input_scaling_factors.txt
+const int n_scaling_factors = 9;
+extern const char* scaling_factor_names[n_scaling_factors];
+
+#endif // SCIANTIX_SCALING_FACTOR_DECLARATION_H
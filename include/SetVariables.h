@@ -28,4 +28,7 @@
 #include "MapInputVariable.h"
 #include "MapPhysicsVariable.h"
 
-void SetVariables(int Sciantix_options[], double Sciantix_history[], double Sciantix_variables[], double Sciantix_scaling_factors[], double Sciantix_diffusion_modes[]);
+void SetVariables(int Sciantix_options[], Real Sciantix_history[], Real Sciantix_variables[], Real Sciantix_scaling_factors[], Real Sciantix_diffusion_modes[]);
+
+/// Sets the scaling factors (sf_*) of the node, as SetVariables
+void SetScalingFactors(Real Sciantix_scaling_factors[]);
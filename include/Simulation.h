@@ -53,30 +53,30 @@ class Simulation : public Solver, public Model
 		/// @brief Burnup uses the solver Integrator to computes the fuel burnup from the local power density.
 		/// This method is called in Sciantix.cpp, after the definition of the Burnup model.
 		
-		sciantix_variable[sv["Burnup"]].setFinalValue(
+		sciantix_variable[sv_burnup].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["Burnup"]].getInitialValue(),
-				model[sm["Burnup"]].getParameter().at(0),
-				physics_variable[pv["Time step"]].getFinalValue()
+				sciantix_variable[sv_burnup].getInitialValue(),
+				model[sm_burnup].getParameter().at(0),
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);
 
-		if(history_variable[hv["Fission rate"]].getFinalValue() > 0.0)
-			sciantix_variable[sv["Irradiation time"]].setFinalValue(
+		if(history_variable[hv_fission_rate].getFinalValue() > 0.0)
+			sciantix_variable[sv_irradiation_time].setFinalValue(
 				solver.Integrator(
-					sciantix_variable[sv["Irradiation time"]].getInitialValue(),
-					1.0 / sciantix_variable[sv["Specific power"]].getFinalValue(),
-					24.0 * sciantix_variable[sv["Burnup"]].getIncrement()
+					sciantix_variable[sv_irradiation_time].getInitialValue(),
+					1.0 / sciantix_variable[sv_specific_power].getFinalValue(),
+					24.0 * sciantix_variable[sv_burnup].getIncrement()
 				)
 			);
 		else
-			sciantix_variable[sv["Irradiation time"]].setConstant();
+			sciantix_variable[sv_irradiation_time].setConstant();
 			
-		sciantix_variable[sv["FIMA"]].setFinalValue(
+		sciantix_variable[sv_fima].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["FIMA"]].getInitialValue(),
-				history_variable[hv["Fission rate"]].getFinalValue() * 3.6e5 / sciantix_variable[sv["U"]].getFinalValue(), 
-				sciantix_variable[sv["Irradiation time"]].getIncrement()
+				sciantix_variable[sv_fima].getInitialValue(),
+				history_variable[hv_fission_rate].getFinalValue() * 3.6e5 / sciantix_variable[sv_u].getFinalValue(), 
+				sciantix_variable[sv_irradiation_time].getIncrement()
 			)
 		);
 	}
@@ -86,11 +86,11 @@ class Simulation : public Solver, public Model
 		/// @brief EffectiveBurnup uses the solver Integrator to computes the effective burnup of the fuel, if the
 		/// criteria on the temperature are required.
 		/// This method is called in Sciantix.cpp after the definition of the effective burnup model.
-		sciantix_variable[sv["Effective burnup"]].setFinalValue(
+		sciantix_variable[sv_effective_burnup].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["Effective burnup"]].getInitialValue(),
-				model[sm["Effective burnup"]].getParameter().at(0),
-				physics_variable[pv["Time step"]].getFinalValue()
+				sciantix_variable[sv_effective_burnup].getInitialValue(),
+				model[sm_effective_burnup].getParameter().at(0),
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);
 	}
@@ -105,19 +105,19 @@ class Simulation : public Solver, public Model
     	for (auto& system : sciantix_system)
 		{	
 			if(system.getRestructuredMatrix() == 0)
-				sciantix_variable[sv[system.getGasName() + " produced"]].setFinalValue(
+				sciantix_variable[system.getHandle(System::produced)].setFinalValue(
 					solver.Integrator(
-						sciantix_variable[sv[system.getGasName() + " produced"]].getInitialValue(),
-						model[sm["Gas production - " + system.getName()]].getParameter().at(0),
-						model[sm["Gas production - " + system.getName()]].getParameter().at(1)
+						sciantix_variable[system.getHandle(System::produced)].getInitialValue(),
+						model[system.getHandle(System::gas_production_model)].getParameter().at(0),
+						model[system.getHandle(System::gas_production_model)].getParameter().at(1)
 					)
 				);
 			else if(system.getRestructuredMatrix() == 1)
-				sciantix_variable[sv[system.getGasName() + " produced in HBS"]].setFinalValue(
+				sciantix_variable[system.getHandle(System::produced_in_hbs)].setFinalValue(
 					solver.Integrator(
-						sciantix_variable[sv[system.getGasName() + " produced in HBS"]].getInitialValue(),
-						model[sm["Gas production - " + system.getName()]].getParameter().at(0),
-						model[sm["Gas production - " + system.getName()]].getParameter().at(1)
+						sciantix_variable[system.getHandle(System::produced_in_hbs)].getInitialValue(),
+						model[system.getHandle(System::gas_production_model)].getParameter().at(0),
+						model[system.getHandle(System::gas_production_model)].getParameter().at(1)
 					)
 				);
 		}
@@ -127,57 +127,60 @@ class Simulation : public Solver, public Model
 	{
     	for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() > 0.0 && system.getRestructuredMatrix() == 0)
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() > 0.0 && system.getRestructuredMatrix() == 0)
 			{
-				sciantix_variable[sv[system.getGasName() + " decayed"]].setFinalValue(
+				sciantix_variable[system.getHandle(System::decayed)].setFinalValue(
 					solver.Decay(
-						sciantix_variable[sv[system.getGasName() + " decayed"]].getInitialValue(),
-						gas[ga[system.getGasName()]].getDecayRate(),
-						gas[ga[system.getGasName()]].getDecayRate() * sciantix_variable[sv[system.getGasName() + " produced"]].getFinalValue(), // sarebbe produced + produced in HBS ma le seconde devono esistere per tutte le specie..
-						physics_variable[pv["Time step"]].getFinalValue()
+						sciantix_variable[system.getHandle(System::decayed)].getInitialValue(),
+						gas[system.getHandle(System::gas_index)].getDecayRate(),
+						gas[system.getHandle(System::gas_index)].getDecayRate() * sciantix_variable[system.getHandle(System::produced)].getFinalValue(), // sarebbe produced + produced in HBS ma le seconde devono esistere per tutte le specie..
+						physics_variable[pv_time_step].getFinalValue()
 					)
 				);
 			}
 		}
 	}
 
-	void GasDiffusion()
+	/// With solved_modes, the spectral diffusion of iDiffusionSolver = 1 has already been computed (the modes and the gas in grain),
+	/// across the nodes of a batch (see SciantixBatch)
+	void GasDiffusion(bool solved_modes = false)
 	{
     	for (auto& system : sciantix_system)
 		{
-			switch (int(input_variable[iv["iDiffusionSolver"]].getValue()))
+			switch (int(input_variable[iv_diffusion_solver].getValue()))
 			{
 				case 1:
 				{
 					if (system.getRestructuredMatrix() == 0)
 					{
-						sciantix_variable[sv[system.getGasName() + " in grain"]].setFinalValue(
-							solver.SpectralDiffusion(
-								getDiffusionModes(system.getGasName()),
-								model[sm["Gas diffusion - " + system.getName()]].getParameter(),
-								physics_variable[pv["Time step"]].getFinalValue()
-							)
-						);
-
-						double equilibrium_fraction(1.0);
+						if (!solved_modes)
+							sciantix_variable[system.getHandle(System::in_grain)].setFinalValue(
+								solver.SpectralDiffusion(
+									getDiffusionModes(system),
+									model[system.getHandle(System::gas_diffusion_model)].getParameter(),
+									physics_variable[pv_time_step].getFinalValue()
+								)
+							);
+
+						Real equilibrium_fraction(1.0);
 						if ((system.getResolutionRate() + system.getTrappingRate()) > 0.0)
 							equilibrium_fraction = system.getResolutionRate() / (system.getResolutionRate() + system.getTrappingRate());
 
-						sciantix_variable[sv[system.getGasName() + " in intragranular solution"]].setFinalValue(
-							equilibrium_fraction * sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue()
+						sciantix_variable[system.getHandle(System::in_intragranular_solution)].setFinalValue(
+							equilibrium_fraction * sciantix_variable[system.getHandle(System::in_grain)].getFinalValue()
 						);
 
-						sciantix_variable[sv[system.getGasName() + " in intragranular bubbles"]].setFinalValue(
-							(1.0 - equilibrium_fraction) * sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue()
+						sciantix_variable[system.getHandle(System::in_intragranular_bubbles)].setFinalValue(
+							(1.0 - equilibrium_fraction) * sciantix_variable[system.getHandle(System::in_grain)].getFinalValue()
 						);
 					}
-					else if (system.getRestructuredMatrix() == 1)
+					else if (system.getRestructuredMatrix() == 1 && !solved_modes)
 					{
-						sciantix_variable[sv[system.getGasName() + " in grain HBS"]].setFinalValue(
+						sciantix_variable[system.getHandle(System::in_grain_hbs)].setFinalValue(
 							solver.SpectralDiffusion(
-								getDiffusionModes(system.getGasName() + " in HBS"),
-								model[sm["Gas diffusion - " + system.getName()]].getParameter(),
-								physics_variable[pv["Time step"]].getFinalValue()
+								getDiffusionModes(system),
+								model[system.getHandle(System::gas_diffusion_model)].getParameter(),
+								physics_variable[pv_time_step].getFinalValue()
 							)
 						);
 					}
@@ -186,28 +189,28 @@ class Simulation : public Solver, public Model
 
 				case 2:
 				{
-					double initial_value_solution(0.0), initial_value_bubbles(0.0);
+					Real initial_value_solution(0.0), initial_value_bubbles(0.0);
 
 					if (system.getRestructuredMatrix() == 0)
 					{
-						initial_value_solution = sciantix_variable[sv[system.getGasName() + " in intragranular solution"]].getFinalValue();
-						initial_value_bubbles  = sciantix_variable[sv[system.getGasName() + " in intragranular bubbles"]].getFinalValue();
+						initial_value_solution = sciantix_variable[system.getHandle(System::in_intragranular_solution)].getFinalValue();
+						initial_value_bubbles  = sciantix_variable[system.getHandle(System::in_intragranular_bubbles)].getFinalValue();
 
 						solver.SpectralDiffusion2equations(
 							initial_value_solution,
 							initial_value_bubbles,
-							getDiffusionModesSolution(system.getGasName()),
-							getDiffusionModesBubbles(system.getGasName()),
-							model[sm["Gas diffusion - " + system.getName()]].getParameter(),
-							physics_variable[pv["Time step"]].getFinalValue()
+							getDiffusionModesSolution(system),
+							getDiffusionModesBubbles(system),
+							model[system.getHandle(System::gas_diffusion_model)].getParameter(),
+							physics_variable[pv_time_step].getFinalValue()
 						);
-						sciantix_variable[sv[system.getGasName() + " in intragranular solution"]].setFinalValue(initial_value_solution);
-						sciantix_variable[sv[system.getGasName() + " in intragranular bubbles"]].setFinalValue(initial_value_bubbles);
-						sciantix_variable[sv[system.getGasName() + " in grain"]].setFinalValue(initial_value_solution + initial_value_bubbles);
+						sciantix_variable[system.getHandle(System::in_intragranular_solution)].setFinalValue(initial_value_solution);
+						sciantix_variable[system.getHandle(System::in_intragranular_bubbles)].setFinalValue(initial_value_bubbles);
+						sciantix_variable[system.getHandle(System::in_grain)].setFinalValue(initial_value_solution + initial_value_bubbles);
 					}
 					else if (system.getRestructuredMatrix() == 1)
 					{
-						sciantix_variable[sv[system.getGasName() + " in grain HBS"]].setFinalValue(0.0);
+						sciantix_variable[system.getHandle(System::in_grain_hbs)].setFinalValue(0.0);
 					}					
 					break;
 				}
@@ -216,37 +219,37 @@ class Simulation : public Solver, public Model
 					break;
 
 				default:
-					ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv["iDiffusionSolver"]].getValue()));
+					ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv_diffusion_solver].getValue()));
 					break;
 			}
 		}
 
-		if (int(input_variable[iv["iDiffusionSolver"]].getValue()) == 3)
+		if (int(input_variable[iv_diffusion_solver].getValue()) == 3)
 		{
-			double initial_value_solution(0.0), initial_value_bubbles(0.0), initial_value_hbs(0.0);
+			Real initial_value_solution(0.0), initial_value_bubbles(0.0), initial_value_hbs(0.0);
 
-			initial_value_solution = sciantix_variable[sv["Xe in intragranular solution"]].getFinalValue();
-			initial_value_bubbles = sciantix_variable[sv["Xe in intragranular bubbles"]].getFinalValue();
-			initial_value_hbs  = sciantix_variable[sv["Xe in grain HBS"]].getFinalValue();
+			initial_value_solution = sciantix_variable[sv_xe_in_intragranular_solution].getFinalValue();
+			initial_value_bubbles = sciantix_variable[sv_xe_in_intragranular_bubbles].getFinalValue();
+			initial_value_hbs  = sciantix_variable[sv_xe_in_grain_hbs].getFinalValue();
 
 			solver.SpectralDiffusion3equations(
 				initial_value_solution,
 				initial_value_bubbles,
 				initial_value_hbs,
-				getDiffusionModesSolution("Xe"),
-				getDiffusionModesBubbles("Xe"),
-				getDiffusionModes("Xe in HBS"),
-				model[sm["Gas diffusion - Xe in UO2 with HBS"]].getParameter(),
-				physics_variable[pv["Time step"]].getFinalValue()
+				getDiffusionModesSolution(sciantix_system[sy_xe_in_uo2]),
+				getDiffusionModesBubbles(sciantix_system[sy_xe_in_uo2]),
+				getDiffusionModes(sciantix_system[sy_xe_in_uo2hbs]),
+				model[sm_gas_diffusion_xe_in_uo2_with_hbs].getParameter(),
+				physics_variable[pv_time_step].getFinalValue()
 			);
-			sciantix_variable[sv["Xe in grain"]].setFinalValue(initial_value_solution + initial_value_bubbles);
-			sciantix_variable[sv["Xe in intragranular solution"]].setFinalValue(initial_value_solution);
-			sciantix_variable[sv["Xe in intragranular bubbles"]].setFinalValue(initial_value_bubbles);
-			sciantix_variable[sv["Xe in grain HBS"]].setFinalValue(initial_value_hbs);
-
-			sciantix_variable[sv["Intragranular gas solution swelling"]].setFinalValue(
-				(sciantix_variable[sv["Xe in intragranular solution"]].getFinalValue() + sciantix_variable[sv["Xe in grain HBS"]].getFinalValue()) *
-				pow(matrix[sma["UO2"]].getLatticeParameter(), 3) / 4
+			sciantix_variable[sv_xe_in_grain].setFinalValue(initial_value_solution + initial_value_bubbles);
+			sciantix_variable[sv_xe_in_intragranular_solution].setFinalValue(initial_value_solution);
+			sciantix_variable[sv_xe_in_intragranular_bubbles].setFinalValue(initial_value_bubbles);
+			sciantix_variable[sv_xe_in_grain_hbs].setFinalValue(initial_value_hbs);
+
+			sciantix_variable[sv_intragranular_gas_solution_swelling].setFinalValue(
+				(sciantix_variable[sv_xe_in_intragranular_solution].getFinalValue() + sciantix_variable[sv_xe_in_grain_hbs].getFinalValue()) *
+				pow(matrix[sma_uo2].getLatticeParameter(), 3) / 4
 			);
 		}
 
@@ -255,15 +258,15 @@ class Simulation : public Solver, public Model
 		{
 			if(system.getRestructuredMatrix() == 0)
 			{
-				sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setFinalValue(
-					sciantix_variable[sv[system.getGasName() + " produced"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " decayed"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " released"]].getInitialValue()
+				sciantix_variable[system.getHandle(System::at_grain_boundary)].setFinalValue(
+					sciantix_variable[system.getHandle(System::produced)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::decayed)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::in_grain)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::released)].getInitialValue()
 				);
 
-				if (sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getFinalValue() < 0.0)
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setFinalValue(0.0);
+				if (sciantix_variable[system.getHandle(System::at_grain_boundary)].getFinalValue() < 0.0)
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].setFinalValue(0.0);
 			}
 		}
 
@@ -272,20 +275,20 @@ class Simulation : public Solver, public Model
 		 * all the gas arriving at the grain boundary is released.
 		 * 
 		 */
-		if (input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 0)
+		if (input_variable[iv_grain_boundary_behaviour].getValue() == 0)
 		{
 			for (auto& system : sciantix_system)
 			{
 				if(system.getRestructuredMatrix() == 0)
 				{
 					{
-						sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setInitialValue(0.0);
-						sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setFinalValue(0.0);
+						sciantix_variable[system.getHandle(System::at_grain_boundary)].setInitialValue(0.0);
+						sciantix_variable[system.getHandle(System::at_grain_boundary)].setFinalValue(0.0);
 
-						sciantix_variable[sv[system.getGasName() + " released"]].setFinalValue(
-							sciantix_variable[sv[system.getGasName() + " produced"]].getFinalValue() -
-							sciantix_variable[sv[system.getGasName() + " decayed"]].getFinalValue() -
-							sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue()
+						sciantix_variable[system.getHandle(System::released)].setFinalValue(
+							sciantix_variable[system.getHandle(System::produced)].getFinalValue() -
+							sciantix_variable[system.getHandle(System::decayed)].getFinalValue() -
+							sciantix_variable[system.getHandle(System::in_grain)].getFinalValue()
 						);
 					}
 				}
@@ -299,11 +302,15 @@ class Simulation : public Solver, public Model
 		 * @brief ### GrainGrowth
 		 * 
 		 */
-		sciantix_variable[sv["Grain radius"]].setFinalValue(
-			solver.QuarticEquation(model[sm["Grain growth"]].getParameter())
+		NewtonWarmStart<Real> warm_start(sciantix_variable[sv_grain_growth_newton_root].getInitialValue());
+
+		sciantix_variable[sv_grain_radius].setFinalValue(
+			solver.QuarticEquation(model[sm_grain_growth].getParameter(), getWarmStart(warm_start))
 		);
 
-		matrix[sma["UO2"]].setGrainRadius(sciantix_variable[sv["Grain radius"]].getFinalValue());
+		sciantix_variable[sv_grain_growth_newton_root].setFinalValue(warm_start.getRoot());
+
+		matrix[sma_uo2].setGrainRadius(sciantix_variable[sv_grain_radius].getFinalValue());
 	}
 
 	void IntraGranularBubbleBehaviour()
@@ -315,49 +322,49 @@ class Simulation : public Solver, public Model
 		 */
 
 		// dN / dt = - getParameter().at(0) * N + getParameter().at(1)
-		sciantix_variable[sv["Intragranular bubble concentration"]].setFinalValue(
+		sciantix_variable[sv_intragranular_bubble_concentration].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Intragranular bubble concentration"]].getInitialValue(),
-				model[sm["Intragranular bubble evolution"]].getParameter().at(0),
-				model[sm["Intragranular bubble evolution"]].getParameter().at(1),
-				physics_variable[pv["Time step"]].getFinalValue()
+				sciantix_variable[sv_intragranular_bubble_concentration].getInitialValue(),
+				model[sm_intragranular_bubble_evolution].getParameter().at(0),
+				model[sm_intragranular_bubble_evolution].getParameter().at(1),
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);
 
 		// Atom per bubbles and bubble radius
 		for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
 			{
-				if (sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue() > 0.0)
-					sciantix_variable[sv["Intragranular " + system.getGasName() + " atoms per bubble"]].setFinalValue(
-						sciantix_variable[sv[system.getGasName() + " in intragranular bubbles"]].getFinalValue() /
-						sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue()
+				if (sciantix_variable[sv_intragranular_bubble_concentration].getFinalValue() > 0.0)
+					sciantix_variable[system.getHandle(System::intragranular_atoms_per_bubble)].setFinalValue(
+						sciantix_variable[system.getHandle(System::in_intragranular_bubbles)].getFinalValue() /
+						sciantix_variable[sv_intragranular_bubble_concentration].getFinalValue()
 					);
 
 				else
-					sciantix_variable[sv["Intragranular " + system.getGasName() + " atoms per bubble"]].setFinalValue(0.0);
+					sciantix_variable[system.getHandle(System::intragranular_atoms_per_bubble)].setFinalValue(0.0);
 
-				sciantix_variable[sv["Intragranular bubble volume"]].addValue(
-					system.getVolumeInLattice() * sciantix_variable[sv["Intragranular " + system.getGasName() + " atoms per bubble"]].getFinalValue()
+				sciantix_variable[sv_intragranular_bubble_volume].addValue(
+					system.getVolumeInLattice() * sciantix_variable[system.getHandle(System::intragranular_atoms_per_bubble)].getFinalValue()
 				);
 			}
 		}
 
 		// Intragranular bubble radius
-		sciantix_variable[sv["Intragranular bubble radius"]].setFinalValue(0.620350491 * pow(sciantix_variable[sv["Intragranular bubble volume"]].getFinalValue(), (1.0 / 3.0)));
+		sciantix_variable[sv_intragranular_bubble_radius].setFinalValue(0.620350491 * pow(sciantix_variable[sv_intragranular_bubble_volume].getFinalValue(), (1.0 / 3.0)));
 
 		// Swelling
 		// 4/3 pi N R^3
-		sciantix_variable[sv["Intragranular gas bubble swelling"]].setFinalValue(4.188790205 *
-			pow(sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), 3) *
-			sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue()
+		sciantix_variable[sv_intragranular_gas_bubble_swelling].setFinalValue(4.188790205 *
+			pow(sciantix_variable[sv_intragranular_bubble_radius].getFinalValue(), 3) *
+			sciantix_variable[sv_intragranular_bubble_concentration].getFinalValue()
 		);
 
-		if(sciantix_variable[sv["He in intragranular bubbles"]].getInitialValue() > 0.0)
-			sciantix_variable[sv["Intragranular similarity ratio"]].setFinalValue(sqrt(sciantix_variable[sv["He in intragranular bubbles"]].getFinalValue() / sciantix_variable[sv["He in intragranular bubbles"]].getInitialValue()));
+		if(sciantix_variable[sv_he_in_intragranular_bubbles].getInitialValue() > 0.0)
+			sciantix_variable[sv_intragranular_similarity_ratio].setFinalValue(sqrt(sciantix_variable[sv_he_in_intragranular_bubbles].getFinalValue() / sciantix_variable[sv_he_in_intragranular_bubbles].getInitialValue()));
 		else
-			sciantix_variable[sv["Intragranular similarity ratio"]].setFinalValue(0.0);
+			sciantix_variable[sv_intragranular_similarity_ratio].setFinalValue(0.0);
 	}
 
 	void InterGranularBubbleBehaviour()
@@ -365,82 +372,82 @@ class Simulation : public Solver, public Model
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
 		// Vacancy concentration
-		sciantix_variable[sv["Intergranular vacancies per bubble"]].setFinalValue(
-			solver.LimitedGrowth(sciantix_variable[sv["Intergranular vacancies per bubble"]].getInitialValue(),
-				model[sm["Intergranular bubble evolution"]].getParameter(),
-				physics_variable[pv["Time step"]].getFinalValue()
+		sciantix_variable[sv_intergranular_vacancies_per_bubble].setFinalValue(
+			solver.LimitedGrowth(sciantix_variable[sv_intergranular_vacancies_per_bubble].getInitialValue(),
+				model[sm_intergranular_bubble_evolution].getParameter(),
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);
 
 		// Grain-boundary bubble volume
-		double vol(0);
+		Real vol(0);
 		for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
 			{
-				vol += sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].getFinalValue() *
-					gas[ga[system.getGasName()]].getVanDerWaalsVolume();
+				vol += sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].getFinalValue() *
+					gas[system.getHandle(System::gas_index)].getVanDerWaalsVolume();
 			}
 		}
-		vol += sciantix_variable[sv["Intergranular vacancies per bubble"]].getFinalValue() * matrix[sma["UO2"]].getSchottkyVolume();
-		sciantix_variable[sv["Intergranular bubble volume"]].setFinalValue(vol);
+		vol += sciantix_variable[sv_intergranular_vacancies_per_bubble].getFinalValue() * matrix[sma_uo2].getSchottkyVolume();
+		sciantix_variable[sv_intergranular_bubble_volume].setFinalValue(vol);
 
 		// Grain-boundary bubble radius
-		sciantix_variable[sv["Intergranular bubble radius"]].setFinalValue(
-			0.620350491 * pow(sciantix_variable[sv["Intergranular bubble volume"]].getFinalValue() / (matrix[sma["UO2"]].getLenticularShapeFactor()), 1. / 3.));
+		sciantix_variable[sv_intergranular_bubble_radius].setFinalValue(
+			0.620350491 * pow(sciantix_variable[sv_intergranular_bubble_volume].getFinalValue() / (matrix[sma_uo2].getLenticularShapeFactor()), 1. / 3.));
 
 		// Grain-boundary bubble area
-		sciantix_variable[sv["Intergranular bubble area"]].setFinalValue(
-			pi * pow(sciantix_variable[sv["Intergranular bubble radius"]].getFinalValue() * sin(matrix[sma["UO2"]].getSemidihedralAngle()), 2));
+		sciantix_variable[sv_intergranular_bubble_area].setFinalValue(
+			pi * pow(sciantix_variable[sv_intergranular_bubble_radius].getFinalValue() * sin(matrix[sma_uo2].getSemidihedralAngle()), 2));
 
 		// Grain-boundary bubble coalescence
-		double dbubble_area = sciantix_variable[sv["Intergranular bubble area"]].getIncrement();
-		sciantix_variable[sv["Intergranular bubble concentration"]].setFinalValue(
-			solver.BinaryInteraction(sciantix_variable[sv["Intergranular bubble concentration"]].getInitialValue(), 2.0, dbubble_area));
+		Real dbubble_area = sciantix_variable[sv_intergranular_bubble_area].getIncrement();
+		sciantix_variable[sv_intergranular_bubble_concentration].setFinalValue(
+			solver.BinaryInteraction(sciantix_variable[sv_intergranular_bubble_concentration].getInitialValue(), 2.0, dbubble_area));
 
 		// Conservation
 		for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
 			{
-				sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].rescaleFinalValue(
-					sciantix_variable[sv["Intergranular bubble concentration"]].getInitialValue() / sciantix_variable[sv["Intergranular bubble concentration"]].getFinalValue()
+				sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].rescaleFinalValue(
+					sciantix_variable[sv_intergranular_bubble_concentration].getInitialValue() / sciantix_variable[sv_intergranular_bubble_concentration].getFinalValue()
 				);
 			}
 		}
 
-		double n_at(0);
+		Real n_at(0);
 		for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-				n_at += sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].getFinalValue();
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+				n_at += sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].getFinalValue();
 		}
-		sciantix_variable[sv["Intergranular atoms per bubble"]].setFinalValue(n_at);
+		sciantix_variable[sv_intergranular_atoms_per_bubble].setFinalValue(n_at);
 
-		sciantix_variable[sv["Intergranular vacancies per bubble"]].rescaleFinalValue(
-			sciantix_variable[sv["Intergranular bubble concentration"]].getInitialValue() / sciantix_variable[sv["Intergranular bubble concentration"]].getFinalValue()
+		sciantix_variable[sv_intergranular_vacancies_per_bubble].rescaleFinalValue(
+			sciantix_variable[sv_intergranular_bubble_concentration].getInitialValue() / sciantix_variable[sv_intergranular_bubble_concentration].getFinalValue()
 		);
 
 		vol = 0.0;
 		for (auto& system : sciantix_system)
 		{
-			if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-				vol += sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].getFinalValue() *
-					gas[ga[system.getGasName()]].getVanDerWaalsVolume();
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+				vol += sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].getFinalValue() *
+					gas[system.getHandle(System::gas_index)].getVanDerWaalsVolume();
 		}
-		vol += sciantix_variable[sv["Intergranular vacancies per bubble"]].getFinalValue() * matrix[sma["UO2"]].getSchottkyVolume();
-		sciantix_variable[sv["Intergranular bubble volume"]].setFinalValue(vol);
+		vol += sciantix_variable[sv_intergranular_vacancies_per_bubble].getFinalValue() * matrix[sma_uo2].getSchottkyVolume();
+		sciantix_variable[sv_intergranular_bubble_volume].setFinalValue(vol);
 
-		sciantix_variable[sv["Intergranular bubble radius"]].setFinalValue(
-			0.620350491 * pow(sciantix_variable[sv["Intergranular bubble volume"]].getFinalValue() / (matrix[sma["UO2"]].getLenticularShapeFactor()), 1. / 3.));
+		sciantix_variable[sv_intergranular_bubble_radius].setFinalValue(
+			0.620350491 * pow(sciantix_variable[sv_intergranular_bubble_volume].getFinalValue() / (matrix[sma_uo2].getLenticularShapeFactor()), 1. / 3.));
 
-		sciantix_variable[sv["Intergranular bubble area"]].setFinalValue(
-			pi * pow(sciantix_variable[sv["Intergranular bubble radius"]].getFinalValue() * sin(matrix[sma["UO2"]].getSemidihedralAngle()), 2));
+		sciantix_variable[sv_intergranular_bubble_area].setFinalValue(
+			pi * pow(sciantix_variable[sv_intergranular_bubble_radius].getFinalValue() * sin(matrix[sma_uo2].getSemidihedralAngle()), 2));
 
 		// Fractional coverage
-		sciantix_variable[sv["Intergranular fractional coverage"]].setFinalValue(
-			sciantix_variable[sv["Intergranular bubble area"]].getFinalValue() *
-			sciantix_variable[sv["Intergranular bubble concentration"]].getFinalValue());
+		sciantix_variable[sv_intergranular_fractional_coverage].setFinalValue(
+			sciantix_variable[sv_intergranular_bubble_area].getFinalValue() *
+			sciantix_variable[sv_intergranular_bubble_concentration].getFinalValue());
 
 		// Intergranular gas release
 		//                          F0
@@ -450,44 +457,44 @@ class Simulation : public Solver, public Model
 		//   |          F1        N1 N0
 		//   |                    |  |
 		//   |____________________|__|
-		double similarity_ratio;
+		Real similarity_ratio;
 		
-		if (sciantix_variable[sv["Intergranular fractional coverage"]].getFinalValue() > 0.0)
+		if (sciantix_variable[sv_intergranular_fractional_coverage].getFinalValue() > 0.0)
 			similarity_ratio = sqrt(
-				sciantix_variable[sv["Intergranular saturation fractional coverage"]].getFinalValue() /
-				sciantix_variable[sv["Intergranular fractional coverage"]].getFinalValue()
+				sciantix_variable[sv_intergranular_saturation_fractional_coverage].getFinalValue() /
+				sciantix_variable[sv_intergranular_fractional_coverage].getFinalValue()
 			);
 		else
 			similarity_ratio = 1.0;
 
 		if (similarity_ratio < 1.0)
 		{
-			sciantix_variable[sv["Intergranular bubble area"]].rescaleFinalValue(similarity_ratio);
-			sciantix_variable[sv["Intergranular bubble concentration"]].rescaleFinalValue(similarity_ratio);
-			sciantix_variable[sv["Intergranular fractional coverage"]].rescaleFinalValue(pow(similarity_ratio, 2));
-			sciantix_variable[sv["Intergranular bubble volume"]].rescaleFinalValue(pow(similarity_ratio, 1.5));
-			sciantix_variable[sv["Intergranular bubble radius"]].rescaleFinalValue(pow(similarity_ratio, 0.5));
-			sciantix_variable[sv["Intergranular vacancies per bubble"]].rescaleFinalValue(pow(similarity_ratio, 1.5));
+			sciantix_variable[sv_intergranular_bubble_area].rescaleFinalValue(similarity_ratio);
+			sciantix_variable[sv_intergranular_bubble_concentration].rescaleFinalValue(similarity_ratio);
+			sciantix_variable[sv_intergranular_fractional_coverage].rescaleFinalValue(pow(similarity_ratio, 2));
+			sciantix_variable[sv_intergranular_bubble_volume].rescaleFinalValue(pow(similarity_ratio, 1.5));
+			sciantix_variable[sv_intergranular_bubble_radius].rescaleFinalValue(pow(similarity_ratio, 0.5));
+			sciantix_variable[sv_intergranular_vacancies_per_bubble].rescaleFinalValue(pow(similarity_ratio, 1.5));
 
 			// New intergranular gas concentration
 			for (auto& system : sciantix_system)
 			{
-				if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-					sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].rescaleFinalValue(pow(similarity_ratio, 1.5));
+				if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+					sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].rescaleFinalValue(pow(similarity_ratio, 1.5));
 			}
 
 			n_at = 0.0;
 			for (auto& system : sciantix_system)
 			{
-				if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-					n_at += sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].getFinalValue();
+				if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+					n_at += sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].getFinalValue();
 			}
-			sciantix_variable[sv["Intergranular atoms per bubble"]].setFinalValue(n_at);
+			sciantix_variable[sv_intergranular_atoms_per_bubble].setFinalValue(n_at);
 
 			for (auto& system : sciantix_system)
 			{
 				if (system.getRestructuredMatrix() == 0)
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].rescaleFinalValue(pow(similarity_ratio, 2.5));
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].rescaleFinalValue(pow(similarity_ratio, 2.5));
 			}
 		}
 
@@ -496,35 +503,91 @@ class Simulation : public Solver, public Model
 		{
 			if(system.getRestructuredMatrix() == 0)
 			{
-				sciantix_variable[sv[system.getGasName() + " released"]].setFinalValue(
-					sciantix_variable[sv[system.getGasName() + " produced"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " decayed"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getFinalValue()
+				sciantix_variable[system.getHandle(System::released)].setFinalValue(
+					sciantix_variable[system.getHandle(System::produced)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::decayed)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::in_grain)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].getFinalValue()
 				);
 
-				if (sciantix_variable[sv[system.getGasName() + " released"]].getFinalValue() < 0.0)
-					sciantix_variable[sv[system.getGasName() + " released"]].setFinalValue(0.0);
+				if (sciantix_variable[system.getHandle(System::released)].getFinalValue() < 0.0)
+					sciantix_variable[system.getHandle(System::released)].setFinalValue(0.0);
 			}
 		}
 
 		// Intergranular gaseous swelling
-		sciantix_variable[sv["Intergranular gas swelling"]].setFinalValue(
-			3 / sciantix_variable[sv["Grain radius"]].getFinalValue() *
-			sciantix_variable[sv["Intergranular bubble concentration"]].getFinalValue() *
-			sciantix_variable[sv["Intergranular bubble volume"]].getFinalValue()
+		sciantix_variable[sv_intergranular_gas_swelling].setFinalValue(
+			3 / sciantix_variable[sv_grain_radius].getFinalValue() *
+			sciantix_variable[sv_intergranular_bubble_concentration].getFinalValue() *
+			sciantix_variable[sv_intergranular_bubble_volume].getFinalValue()
 		);
 	}
 
+	/**
+	 * @brief ### DiffusionModesRounding
+	 * With **iStatePrecision = 1**, the diffusion modes are stored in single precision between the time steps,
+	 * the gas concentrations in double precision. The difference between the concentration and the projection
+	 * of its (rounded) modes is moved to the first mode, before any model updates the modes: the mass balances
+	 * of the time step (e.g., gas at grain boundary = produced - decayed - in grain - released) see the changes
+	 * of the concentrations over the time step only, not the rounding of the modes.
+	 * 
+	 */
+	void DiffusionModesRounding()
+	{
+		for (auto& system : sciantix_system)
+		{
+			switch (int(input_variable[iv_diffusion_solver].getValue()))
+			{
+				case 1:
+					if (system.getRestructuredMatrix() == 0)
+						RestoreModes(getDiffusionModes(system), sciantix_variable[system.getHandle(System::in_grain)].getFinalValue());
+					else if (system.getRestructuredMatrix() == 1)
+						RestoreModes(getDiffusionModes(system), sciantix_variable[system.getHandle(System::in_grain_hbs)].getFinalValue());
+					break;
+
+				case 2:
+					if (system.getRestructuredMatrix() == 0)
+					{
+						RestoreModes(getDiffusionModesSolution(system), sciantix_variable[system.getHandle(System::in_intragranular_solution)].getFinalValue());
+						RestoreModes(getDiffusionModesBubbles(system), sciantix_variable[system.getHandle(System::in_intragranular_bubbles)].getFinalValue());
+					}
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		if (int(input_variable[iv_diffusion_solver].getValue()) == 3)
+		{
+			RestoreModes(getDiffusionModesSolution(sciantix_system[sy_xe_in_uo2]), sciantix_variable[sv_xe_in_intragranular_solution].getFinalValue());
+			RestoreModes(getDiffusionModesBubbles(sciantix_system[sy_xe_in_uo2]), sciantix_variable[sv_xe_in_intragranular_bubbles].getFinalValue());
+			RestoreModes(getDiffusionModes(sciantix_system[sy_xe_in_uo2hbs]), sciantix_variable[sv_xe_in_grain_hbs].getFinalValue());
+		}
+	}
+
+	/// Adds to the first mode the difference between the concentration and the projection of the modes
+	void RestoreModes(Real* modes, Real concentration)
+	{
+		if (modes == nullptr)
+			return;
+
+		const double first_mode_projection = SpectralModeTable::get(n_modes).projection[0] / ((4.0 / 3.0) * CONSTANT_NUMBERS_H::MathConstants::pi);
+		const Real difference = concentration - SpectralDiffusionKernel::Projection(modes, n_modes);
+		modes[0] += difference / first_mode_projection;
+	}
+
 	void GrainBoundarySweeping()
 	{
 		// Sweeping of the intra-granular gas concentrations
 		// dC / df = - C
 
-		if (!input_variable[iv["Grain-boundary sweeping"]].getValue()) return;
+		// The switch has always been looked up as "Grain-boundary sweeping", which is not an input setting
+		// and resolves to the first one (iGrainGrowth): the behaviour is kept as is.
+		if (!input_variable[iv_grain_growth].getValue()) return;
 
 		// intra-granular gas diffusion modes
-		switch (int(input_variable[iv["iDiffusionSolver"]].getValue()))
+		switch (int(input_variable[iv_diffusion_solver].getValue()))
 		{
 			case 1:
 			{
@@ -535,7 +598,7 @@ class Simulation : public Solver, public Model
 							modes_initial_conditions[6 * 40 + i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm_grain_boundary_sweeping].getParameter().at(0)
 						);
 				}
 				
@@ -551,7 +614,7 @@ class Simulation : public Solver, public Model
 							modes_initial_conditions[7 * 40 + i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm_grain_boundary_sweeping].getParameter().at(0)
 						);
 
 					modes_initial_conditions[8 * 40 + i] =
@@ -559,7 +622,7 @@ class Simulation : public Solver, public Model
 							modes_initial_conditions[8 * 40 + i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm_grain_boundary_sweeping].getParameter().at(0)
 						);
 				}
 
@@ -570,7 +633,7 @@ class Simulation : public Solver, public Model
 				break;
 
 			default:
-				// ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv["iDiffusionSolver"]].getValue()));
+				// ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv_diffusion_solver].getValue()));
 				break;
 		}
 	}
@@ -580,98 +643,98 @@ class Simulation : public Solver, public Model
 		/// GrainBoundaryMicroCracking is method of simulation which executes the SCIANTIX simulation for the grain-boundary micro-cracking induced by a temperature difference. 
 		/// This method calls the related model "Grain-boundary micro-cracking", takes the model parameters and solve the model ODEs.
 
-		if (!input_variable[iv["iGrainBoundaryMicroCracking"]].getValue()) return;
+		if (!input_variable[iv_grain_boundary_micro_cracking].getValue()) return;
 
 		// ODE for the intergranular fractional intactness: this equation accounts for the reduction of the intergranular fractional intactness following a temperature transient
 		// df / dT = - dm/dT f
-		sciantix_variable[sv["Intergranular fractional intactness"]].setFinalValue(
-			solver.Decay(sciantix_variable[sv["Intergranular fractional intactness"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0), // 1st parameter = microcracking parameter
+		sciantix_variable[sv_intergranular_fractional_intactness].setFinalValue(
+			solver.Decay(sciantix_variable[sv_intergranular_fractional_intactness].getInitialValue(),
+				model[sm_grain_boundary_micro_cracking].getParameter().at(0), // 1st parameter = microcracking parameter
 				0.0,
-				history_variable[hv["Temperature"]].getIncrement()
+				history_variable[hv_temperature].getIncrement()
 			)
 		);
 
 		// ODE for the intergranular fractional coverage: this equation accounts for the reduction of the intergranular fractional coverage following a temperature transient
 		// dFc / dT = - ( dm/dT f) Fc
-		sciantix_variable[sv["Intergranular fractional coverage"]].setFinalValue(
-			solver.Decay(sciantix_variable[sv["Intergranular fractional coverage"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0) * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
+		sciantix_variable[sv_intergranular_fractional_coverage].setFinalValue(
+			solver.Decay(sciantix_variable[sv_intergranular_fractional_coverage].getInitialValue(),
+				model[sm_grain_boundary_micro_cracking].getParameter().at(0) * sciantix_variable[sv_intergranular_fractional_intactness].getFinalValue(),
 				0.0,
-				history_variable[hv["Temperature"]].getIncrement()
+				history_variable[hv_temperature].getIncrement()
 			)
 		);
 
 		// ODE for the saturation fractional coverage: this equation accounts for the reduction of the intergranular saturation fractional coverage following a temperature transient
 		// dFcsat / dT = - (dm/dT f) Fcsat
-		sciantix_variable[sv["Intergranular saturation fractional coverage"]].setFinalValue(
+		sciantix_variable[sv_intergranular_saturation_fractional_coverage].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Intergranular saturation fractional coverage"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0) * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
+				sciantix_variable[sv_intergranular_saturation_fractional_coverage].getInitialValue(),
+				model[sm_grain_boundary_micro_cracking].getParameter().at(0) * sciantix_variable[sv_intergranular_fractional_intactness].getFinalValue(),
 				0.0,
-				history_variable[hv["Temperature"]].getIncrement()
+				history_variable[hv_temperature].getIncrement()
 			)
 		);
 
 		// ODE for the intergranular fractional intactness: this equation accounts for the healing of the intergranular fractional intactness with burnup
 		// df / dBu = - h f + h
-		sciantix_variable[sv["Intergranular fractional intactness"]].setFinalValue(
+		sciantix_variable[sv_intergranular_fractional_intactness].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(1),  // 2nd parameter = healing parameter
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(1),
-				sciantix_variable[sv["Burnup"]].getIncrement()
+				sciantix_variable[sv_intergranular_fractional_intactness].getFinalValue(),
+				model[sm_grain_boundary_micro_cracking].getParameter().at(1),  // 2nd parameter = healing parameter
+				model[sm_grain_boundary_micro_cracking].getParameter().at(1),
+				sciantix_variable[sv_burnup].getIncrement()
 			)
 		);
 
 		// ODE for the saturation fractional coverage: this equation accounts for the healing of the intergranular saturation fractional coverage with burnup
 		// dFcsat / dBu = h (1-f) Fcsat
-		sciantix_variable[sv["Intergranular saturation fractional coverage"]].setFinalValue(
+		sciantix_variable[sv_intergranular_saturation_fractional_coverage].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Intergranular saturation fractional coverage"]].getFinalValue(),
-				- model[sm["Grain-boundary micro-cracking"]].getParameter().at(1) * (1.0 - sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue()),
+				sciantix_variable[sv_intergranular_saturation_fractional_coverage].getFinalValue(),
+				- model[sm_grain_boundary_micro_cracking].getParameter().at(1) * (1.0 - sciantix_variable[sv_intergranular_fractional_intactness].getFinalValue()),
 				0.0,
-				sciantix_variable[sv["Burnup"]].getIncrement()
+				sciantix_variable[sv_burnup].getIncrement()
 			)
 		);
 
 		// Re-scaling: to maintain the current fractional coverage unchanged
-		double similarity_ratio;
+		Real similarity_ratio;
 		
-		if (sciantix_variable[sv["Intergranular fractional coverage"]].getInitialValue() > 0.0)
+		if (sciantix_variable[sv_intergranular_fractional_coverage].getInitialValue() > 0.0)
 			similarity_ratio = sqrt(
-				sciantix_variable[sv["Intergranular fractional coverage"]].getFinalValue() / sciantix_variable[sv["Intergranular fractional coverage"]].getInitialValue()
+				sciantix_variable[sv_intergranular_fractional_coverage].getFinalValue() / sciantix_variable[sv_intergranular_fractional_coverage].getInitialValue()
 			);
 		else
 			similarity_ratio = 1.0;
 
 		if (similarity_ratio < 1.0)
 		{
-			sciantix_variable[sv["Intergranular bubble area"]].rescaleInitialValue(similarity_ratio);
-			sciantix_variable[sv["Intergranular bubble concentration"]].rescaleInitialValue(similarity_ratio);
-			sciantix_variable[sv["Intergranular fractional coverage"]].rescaleInitialValue(pow(similarity_ratio, 2));
-			sciantix_variable[sv["Intergranular bubble volume"]].rescaleInitialValue(pow(similarity_ratio, 1.5));
-			sciantix_variable[sv["Intergranular bubble radius"]].rescaleInitialValue(pow(similarity_ratio, 0.5));
-			sciantix_variable[sv["Intergranular vacancies per bubble"]].rescaleInitialValue(pow(similarity_ratio, 1.5));
+			sciantix_variable[sv_intergranular_bubble_area].rescaleInitialValue(similarity_ratio);
+			sciantix_variable[sv_intergranular_bubble_concentration].rescaleInitialValue(similarity_ratio);
+			sciantix_variable[sv_intergranular_fractional_coverage].rescaleInitialValue(pow(similarity_ratio, 2));
+			sciantix_variable[sv_intergranular_bubble_volume].rescaleInitialValue(pow(similarity_ratio, 1.5));
+			sciantix_variable[sv_intergranular_bubble_radius].rescaleInitialValue(pow(similarity_ratio, 0.5));
+			sciantix_variable[sv_intergranular_vacancies_per_bubble].rescaleInitialValue(pow(similarity_ratio, 1.5));
 
 			for (auto& system : sciantix_system)
 			{
-				if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-					sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].rescaleInitialValue(pow(similarity_ratio, 1.5));
+				if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+					sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].rescaleInitialValue(pow(similarity_ratio, 1.5));
 			}
 
-			double n_at(0);
+			Real n_at(0);
 			for (auto& system : sciantix_system)
 			{
-				if (gas[ga[system.getGasName()]].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
-					n_at += sciantix_variable[sv["Intergranular " + system.getGasName() + " atoms per bubble"]].getInitialValue();
+				if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+					n_at += sciantix_variable[system.getHandle(System::intergranular_atoms_per_bubble)].getInitialValue();
 			}
-			sciantix_variable[sv["Intergranular atoms per bubble"]].setInitialValue(n_at);
+			sciantix_variable[sv_intergranular_atoms_per_bubble].setInitialValue(n_at);
 
 			for (auto& system : sciantix_system)
 			{	
 				if(system.getRestructuredMatrix() == 0)
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].rescaleFinalValue(pow(similarity_ratio, 2.5));
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].rescaleFinalValue(pow(similarity_ratio, 2.5));
 			}
 		}
 
@@ -680,15 +743,15 @@ class Simulation : public Solver, public Model
 		{
 			if(system.getRestructuredMatrix() == 0)
 			{
-				sciantix_variable[sv[system.getGasName() + " released"]].setFinalValue(
-					sciantix_variable[sv[system.getGasName() + " produced"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " decayed"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " in grain"]].getFinalValue() -
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getFinalValue()
+				sciantix_variable[system.getHandle(System::released)].setFinalValue(
+					sciantix_variable[system.getHandle(System::produced)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::decayed)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::in_grain)].getFinalValue() -
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].getFinalValue()
 				);
 
-				if (sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getFinalValue() < 0.0)
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setFinalValue(0.0);
+				if (sciantix_variable[system.getHandle(System::at_grain_boundary)].getFinalValue() < 0.0)
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].setFinalValue(0.0);
 			}
 		}
 	}
@@ -696,270 +759,242 @@ class Simulation : public Solver, public Model
 	void GrainBoundaryVenting()
 	{
 
-		if (!int(input_variable[iv["iGrainBoundaryVenting"]].getValue())) return;
+		if (!int(input_variable[iv_grain_boundary_venting].getValue())) return;
 
 		for (auto& system : sciantix_system)
 		{
-			sciantix_variable[sv[system.getGasName() + " at grain boundary"]].setFinalValue(
+			sciantix_variable[system.getHandle(System::at_grain_boundary)].setFinalValue(
 				solver.Integrator(
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getFinalValue(),
-					- model[sm["Grain-boundary venting"]].getParameter().at(0),
-					sciantix_variable[sv[system.getGasName() + " at grain boundary"]].getIncrement()
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].getFinalValue(),
+					- model[sm_grain_boundary_venting].getParameter().at(0),
+					sciantix_variable[system.getHandle(System::at_grain_boundary)].getIncrement()
 				)
 			);
-		sciantix_variable[sv[system.getGasName() + " at grain boundary"]].resetValue();
+		sciantix_variable[system.getHandle(System::at_grain_boundary)].resetValue();
 		}
 	}
 
 	void HighBurnupStructureFormation()
 	{
-		if (!int(input_variable[iv["iHighBurnupStructureFormation"]].getValue())) return;
+		if (!int(input_variable[iv_high_burnup_structure_formation].getValue())) return;
 
 		// Restructuring rate:
 		// dalpha_r / bu = 3.54 * 2.77e-7 (1-alpha_r) b^2.54
-		double coefficient =
-			model[sm["High-burnup structure formation"]].getParameter().at(0) *
-			model[sm["High-burnup structure formation"]].getParameter().at(1) *
-			pow(sciantix_variable[sv["Effective burnup"]].getFinalValue(), 2.54);
+		Real coefficient =
+			model[sm_high_burnup_structure_formation].getParameter().at(0) *
+			model[sm_high_burnup_structure_formation].getParameter().at(1) *
+			pow(sciantix_variable[sv_effective_burnup].getFinalValue(), 2.54);
 		
-		sciantix_variable[sv["Restructured volume fraction"]].setFinalValue(
+		sciantix_variable[sv_restructured_volume_fraction].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Restructured volume fraction"]].getInitialValue(),
+				sciantix_variable[sv_restructured_volume_fraction].getInitialValue(),
 				coefficient,
 				coefficient,
-				sciantix_variable[sv["Effective burnup"]].getIncrement()
+				sciantix_variable[sv_effective_burnup].getIncrement()
 				)
 			);
 	}
 
 	void HighBurnupStructurePorosity()
 	{
-		if (!int(input_variable[iv["iHighBurnupStructurePorosity"]].getValue())) return;
+		if (!int(input_variable[iv_high_burnup_structure_porosity].getValue())) return;
 
 		// porosity evolution 
-		sciantix_variable[sv["HBS porosity"]].setFinalValue(
+		sciantix_variable[sv_hbs_porosity].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["HBS porosity"]].getInitialValue(),
-				model[sm["High-burnup structure porosity"]].getParameter().at(0),
-				sciantix_variable[sv["Burnup"]].getIncrement()
+				sciantix_variable[sv_hbs_porosity].getInitialValue(),
+				model[sm_high_burnup_structure_porosity].getParameter().at(0),
+				sciantix_variable[sv_burnup].getIncrement()
 			)
 		);
 
-		if(sciantix_variable[sv["HBS porosity"]].getFinalValue() > 0.15)
-			sciantix_variable[sv["HBS porosity"]].setFinalValue(0.15);
+		if(sciantix_variable[sv_hbs_porosity].getFinalValue() > 0.15)
+			sciantix_variable[sv_hbs_porosity].setFinalValue(0.15);
 
 		// evolution of pore number density via pore nucleation and re-solution
-		if(sciantix_variable[sv["HBS porosity"]].getFinalValue())
-			sciantix_variable[sv["HBS pore density"]].setFinalValue(
+		if(sciantix_variable[sv_hbs_porosity].getFinalValue())
+			sciantix_variable[sv_hbs_pore_density].setFinalValue(
 				solver.Decay(
-						sciantix_variable[sv["HBS pore density"]].getInitialValue(),
-						matrix[sma["UO2HBS"]].getPoreResolutionRate(),
-						matrix[sma["UO2HBS"]].getPoreNucleationRate(),
-						physics_variable[pv["Time step"]].getFinalValue()
+						sciantix_variable[sv_hbs_pore_density].getInitialValue(),
+						matrix[sma_uo2hbs].getPoreResolutionRate(),
+						matrix[sma_uo2hbs].getPoreNucleationRate(),
+						physics_variable[pv_time_step].getFinalValue()
 					)
 				);
 		else
-			sciantix_variable[sv["HBS pore density"]].setFinalValue(0.0);
+			sciantix_variable[sv_hbs_pore_density].setFinalValue(0.0);
 
 		// calculation of pore volume based on porosity and pore number density	
-		if(sciantix_variable[sv["HBS pore density"]].getFinalValue())
-			sciantix_variable[sv["HBS pore volume"]].setFinalValue(
-				sciantix_variable[sv["HBS porosity"]].getFinalValue() / sciantix_variable[sv["HBS pore density"]].getFinalValue());
+		if(sciantix_variable[sv_hbs_pore_density].getFinalValue())
+			sciantix_variable[sv_hbs_pore_volume].setFinalValue(
+				sciantix_variable[sv_hbs_porosity].getFinalValue() / sciantix_variable[sv_hbs_pore_density].getFinalValue());
 
-		sciantix_variable[sv["HBS pore radius"]].setFinalValue(0.620350491 * pow(sciantix_variable[sv["HBS pore volume"]].getFinalValue(), (1.0 / 3.0)));
+		sciantix_variable[sv_hbs_pore_radius].setFinalValue(0.620350491 * pow(sciantix_variable[sv_hbs_pore_volume].getFinalValue(), (1.0 / 3.0)));
 
 		// update of number density of HBS pores: interconnection by impingement
-		double limiting_factor =
-			(2.0 - sciantix_variable[sv["HBS porosity"]].getFinalValue()) /
-			(2.0 * pow(1.0 - sciantix_variable[sv["HBS porosity"]].getFinalValue(), 3.0));
+		Real limiting_factor =
+			(2.0 - sciantix_variable[sv_hbs_porosity].getFinalValue()) /
+			(2.0 * pow(1.0 - sciantix_variable[sv_hbs_porosity].getFinalValue(), 3.0));
 
-		double pore_interconnection_rate = 4.0 * limiting_factor;
-		sciantix_variable[sv["HBS pore density"]].setFinalValue(
+		Real pore_interconnection_rate = 4.0 * limiting_factor;
+		sciantix_variable[sv_hbs_pore_density].setFinalValue(
 			solver.BinaryInteraction(
-				sciantix_variable[sv["HBS pore density"]].getFinalValue(),
+				sciantix_variable[sv_hbs_pore_density].getFinalValue(),
 				pore_interconnection_rate,
-				sciantix_variable[sv["HBS pore volume"]].getIncrement()
+				sciantix_variable[sv_hbs_pore_volume].getIncrement()
 			)
 		);
 		
 		// update of pore volume and pore radius after interconnection by impingement
-		if(sciantix_variable[sv["HBS pore density"]].getFinalValue())
-			sciantix_variable[sv["HBS pore volume"]].setFinalValue(
-				sciantix_variable[sv["HBS porosity"]].getFinalValue() / sciantix_variable[sv["HBS pore density"]].getFinalValue());
+		if(sciantix_variable[sv_hbs_pore_density].getFinalValue())
+			sciantix_variable[sv_hbs_pore_volume].setFinalValue(
+				sciantix_variable[sv_hbs_porosity].getFinalValue() / sciantix_variable[sv_hbs_pore_density].getFinalValue());
 
-		sciantix_variable[sv["HBS pore radius"]].setFinalValue(0.620350491 * pow(sciantix_variable[sv["HBS pore volume"]].getFinalValue(), (1.0 / 3.0)));
+		sciantix_variable[sv_hbs_pore_radius].setFinalValue(0.620350491 * pow(sciantix_variable[sv_hbs_pore_volume].getFinalValue(), (1.0 / 3.0)));
 
 		// average (at/m^3) of gas atoms in HBS pores
-		sciantix_variable[sv["Xe in HBS pores"]].setFinalValue(
+		sciantix_variable[sv_xe_in_hbs_pores].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["Xe in HBS pores"]].getInitialValue(),
+				sciantix_variable[sv_xe_in_hbs_pores].getInitialValue(),
 
-				2.0 * matrix[sma["UO2HBS"]].getPoreNucleationRate() +
-				sciantix_variable[sv["HBS pore density"]].getFinalValue() *
-				(matrix[sma["UO2HBS"]].getPoreTrappingRate() - matrix[sma["UO2HBS"]].getPoreResolutionRate()),
+				2.0 * matrix[sma_uo2hbs].getPoreNucleationRate() +
+				sciantix_variable[sv_hbs_pore_density].getFinalValue() *
+				(matrix[sma_uo2hbs].getPoreTrappingRate() - matrix[sma_uo2hbs].getPoreResolutionRate()),
 
-				physics_variable[pv["Time step"]].getFinalValue()
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);		
 
-		if(sciantix_variable[sv["HBS pore density"]].getFinalValue())
-			sciantix_variable[sv["Xe atoms per HBS pore"]].setFinalValue(
-			sciantix_variable[sv["Xe in HBS pores"]].getFinalValue() / sciantix_variable[sv["HBS pore density"]].getFinalValue()
+		if(sciantix_variable[sv_hbs_pore_density].getFinalValue())
+			sciantix_variable[sv_xe_atoms_per_hbs_pore].setFinalValue(
+			sciantix_variable[sv_xe_in_hbs_pores].getFinalValue() / sciantix_variable[sv_hbs_pore_density].getFinalValue()
 		);
 
-		sciantix_variable[sv["Xe in HBS pores - variance"]].setFinalValue(
+		sciantix_variable[sv_xe_in_hbs_pores_variance].setFinalValue(
 			solver.Integrator(
-				sciantix_variable[sv["Xe in HBS pores - variance"]].getInitialValue(),
+				sciantix_variable[sv_xe_in_hbs_pores_variance].getInitialValue(),
 
-				matrix[sma["UO2"]].getPoreTrappingRate() * sciantix_variable[sv["HBS pore density"]].getFinalValue() -
-				matrix[sma["UO2"]].getPoreResolutionRate() * sciantix_variable[sv["HBS pore density"]].getFinalValue() +
-				matrix[sma["UO2"]].getPoreNucleationRate() * pow((sciantix_variable[sv["Xe atoms per HBS pore"]].getFinalValue()-2.0), 2.0),
+				matrix[sma_uo2].getPoreTrappingRate() * sciantix_variable[sv_hbs_pore_density].getFinalValue() -
+				matrix[sma_uo2].getPoreResolutionRate() * sciantix_variable[sv_hbs_pore_density].getFinalValue() +
+				matrix[sma_uo2].getPoreNucleationRate() * pow((sciantix_variable[sv_xe_atoms_per_hbs_pore].getFinalValue()-2.0), 2.0),
 
-				physics_variable[pv["Time step"]].getFinalValue()
+				physics_variable[pv_time_step].getFinalValue()
 			)
 		);
 
-		if(sciantix_variable[sv["HBS pore density"]].getFinalValue())
-			sciantix_variable[sv["Xe atoms per HBS pore - variance"]].setFinalValue(
-				sciantix_variable[sv["Xe in HBS pores - variance"]].getFinalValue() / sciantix_variable[sv["HBS pore density"]].getFinalValue()
+		if(sciantix_variable[sv_hbs_pore_density].getFinalValue())
+			sciantix_variable[sv_xe_atoms_per_hbs_pore_variance].setFinalValue(
+				sciantix_variable[sv_xe_in_hbs_pores_variance].getFinalValue() / sciantix_variable[sv_hbs_pore_density].getFinalValue()
 			);		
 		}
 
 	void StoichiometryDeviation()
 	{
-		if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
+		if (!input_variable[iv_stoichiometry_deviation].getValue()) return;
 
-		if(history_variable[hv["Temperature"]].getFinalValue() < 1000.0)
+		if(history_variable[hv_temperature].getFinalValue() < 1000.0)
 		{
-			sciantix_variable[sv["Stoichiometry deviation"]].setConstant();
-			sciantix_variable[sv["Fuel oxygen partial pressure"]].setFinalValue(0.0);
+			sciantix_variable[sv_stoichiometry_deviation].setConstant();
+			sciantix_variable[sv_fuel_oxygen_partial_pressure].setFinalValue(0.0);
 		}
 
-		else if(input_variable[iv["iStoichiometryDeviation"]].getValue() < 5)
+		else if(input_variable[iv_stoichiometry_deviation].getValue() < 5)
 		{	
-			sciantix_variable[sv["Stoichiometry deviation"]].setFinalValue(
+			sciantix_variable[sv_stoichiometry_deviation].setFinalValue(
 			solver.Decay(
-				sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue(),
-					model[sm["Stoichiometry deviation"]].getParameter().at(0),
-					model[sm["Stoichiometry deviation"]].getParameter().at(1),
-					physics_variable[pv["Time step"]].getFinalValue()
+				sciantix_variable[sv_stoichiometry_deviation].getInitialValue(),
+					model[sm_stoichiometry_deviation].getParameter().at(0),
+					model[sm_stoichiometry_deviation].getParameter().at(1),
+					physics_variable[pv_time_step].getFinalValue()
 				)
 			);
 		}
 
-		else if(input_variable[iv["iStoichiometryDeviation"]].getValue() > 4)
+		else if(input_variable[iv_stoichiometry_deviation].getValue() > 4)
 		{
-			sciantix_variable[sv["Stoichiometry deviation"]].setFinalValue(
+			NewtonWarmStart<Real> warm_start(sciantix_variable[sv_stoichiometry_deviation_newton_root].getInitialValue());
+
+			sciantix_variable[sv_stoichiometry_deviation].setFinalValue(
 				solver.NewtonLangmuirBasedModel(
-					sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue(),
-						model[sm["Stoichiometry deviation"]].getParameter(),
-						physics_variable[pv["Time step"]].getFinalValue()
+					sciantix_variable[sv_stoichiometry_deviation].getInitialValue(),
+						model[sm_stoichiometry_deviation].getParameter(),
+						physics_variable[pv_time_step].getFinalValue(),
+						getWarmStart(warm_start)
 				)
 			);
+
+			sciantix_variable[sv_stoichiometry_deviation_newton_root].setFinalValue(warm_start.getRoot());
 		}
 
-		sciantix_variable[sv["Fuel oxygen partial pressure"]].setFinalValue(
+		sciantix_variable[sv_fuel_oxygen_partial_pressure].setFinalValue(
 		BlackburnThermochemicalModel(
-			sciantix_variable[sv["Stoichiometry deviation"]].getFinalValue(),
-			history_variable[hv["Temperature"]].getFinalValue()
+			sciantix_variable[sv_stoichiometry_deviation].getFinalValue(),
+			history_variable[hv_temperature].getFinalValue()
 			)
 		);
 	}
 
 	void UO2Thermochemistry()
 	{
-	if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
+	if (!input_variable[iv_stoichiometry_deviation].getValue()) return;
 
-	if(history_variable[hv["Temperature"]].getFinalValue() < 1000.0 || sciantix_variable[sv["Gap oxygen partial pressure"]].getFinalValue() == 0)
-		sciantix_variable[sv["Equilibrium stoichiometry deviation"]].setFinalValue(0.0);
+	if(history_variable[hv_temperature].getFinalValue() < 1000.0 || sciantix_variable[sv_gap_oxygen_partial_pressure].getFinalValue() == 0)
+		sciantix_variable[sv_equilibrium_stoichiometry_deviation].setFinalValue(0.0);
 
 	else
-		sciantix_variable[sv["Equilibrium stoichiometry deviation"]].setFinalValue(
+	{
+		NewtonWarmStart<Real> warm_start(sciantix_variable[sv_uo2_thermochemistry_newton_root].getInitialValue());
+
+		sciantix_variable[sv_equilibrium_stoichiometry_deviation].setFinalValue(
 			solver.NewtonBlackburn(
-				model[sm["UO2 thermochemistry"]].getParameter()
+				model[sm_uo2_thermochemistry].getParameter(),
+				getWarmStart(warm_start)
 					)
 		);
+
+		sciantix_variable[sv_uo2_thermochemistry_newton_root].setFinalValue(warm_start.getRoot());
+	}
+	}
+
+	/// With iNewtonWarmStart = 1, the warm start of a Newton solver (its last converged root, a variable of the node), otherwise none
+	NewtonWarmStart<Real>* getWarmStart(NewtonWarmStart<Real>& warm_start)
+	{
+		return input_variable[iv_newton_warm_start].getValue() ? &warm_start : nullptr;
 	}
 
 	/**
-	 * @brief This method returns a pointer to the array of diffusion modes corresponding to the specified gas.
+	 * @brief This method returns a pointer to the array of diffusion modes corresponding to the gas of the specified system.
 	 * 
-	 * @param gas_name The name of the gas for which diffusion modes are required.
-	 * @return A pointer to the array of diffusion modes for the specified gas.
-	 *         Returns nullptr if the gas name is invalid.
+	 * @param system The system (gas in matrix) for which diffusion modes are required.
+	 * @return A pointer to the array of diffusion modes for the gas of the system.
+	 *         Returns nullptr if the gas has no diffusion modes.
 	 */
-	double* getDiffusionModes(std::string gas_name)
+	Real* getDiffusionModes(System& system)
 	{
-		if(gas_name == "Xe")
-			return &modes_initial_conditions[0];
-		else if(gas_name == "Kr")
-			return &modes_initial_conditions[3 * 40];
-		else if(gas_name == "He")
-			return &modes_initial_conditions[6 * 40];
-		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[9 * 40];
-
-		else if (gas_name == "Kr85m")
-			return &modes_initial_conditions[12 * 40];
-			
-		else if (gas_name == "Xe in HBS")
-			return &modes_initial_conditions[15 * 40];
-
-		else
-		{
-			std::cerr << "Error: Invalid gas name \"" << gas_name << "\" in Simulation::getDiffusionModes." << std::endl;
-			return nullptr;
-		}
+		return getDiffusionModesSection(system, 0, "getDiffusionModes");
 	}
 
-	double* getDiffusionModesSolution(std::string gas_name)
-	{	
-		if(gas_name == "Xe")
-			return &modes_initial_conditions[1 * 40];
-
-		else if(gas_name == "Kr")
-			return &modes_initial_conditions[4 * 40];
-
-		else if(gas_name == "He")
-			return &modes_initial_conditions[7 * 40];
-
-		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[10 * 40];
-
-		else if (gas_name == "Kr85m")
-			return &modes_initial_conditions[13 * 40];
-			
-		else if (gas_name == "Xe in HBS")
-			return &modes_initial_conditions[16 * 40];
-		else
-		{
-			std::cerr << "Error: Invalid gas name \"" << gas_name << "\" in Simulation::getDiffusionModesSolution." << std::endl;
-			return nullptr;
-		}
+	Real* getDiffusionModesSolution(System& system)
+	{
+		return getDiffusionModesSection(system, 1, "getDiffusionModesSolution");
 	}
 
-	double* getDiffusionModesBubbles(std::string gas_name)
-	{	
-		if(gas_name == "Xe")
-			return &modes_initial_conditions[2 * 40];
-
-		else if(gas_name == "Kr")
-			return &modes_initial_conditions[5 * 40];
-
-		else if(gas_name == "He")
-			return &modes_initial_conditions[8 * 40];
-
-		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[11 * 40];
+	Real* getDiffusionModesBubbles(System& system)
+	{
+		return getDiffusionModesSection(system, 2, "getDiffusionModesBubbles");
+	}
 
-		else if (gas_name == "Kr85m")
-			return &modes_initial_conditions[14 * 40];
+	Real* getDiffusionModesSection(System& system, int offset, const char* method)
+	{
+		int section = system.getHandle(System::diffusion_modes_section);
 
-		else
+		if (section < 0)
 		{
-			std::cerr << "Error: Invalid gas name \"" << gas_name << "\" in Simulation::getDiffusionModesBubbles." << std::endl;
+			std::cerr << "Error: Invalid gas name \"" << system.getGasName() << "\" in Simulation::" << method << "." << std::endl;
 			return nullptr;
 		}
+
+		return &modes_initial_conditions[(section + offset) * 40];
 	}
 
 	Simulation() {}
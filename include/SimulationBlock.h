@@ -0,0 +1,704 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIMULATION_BLOCK_H
+#define SIMULATION_BLOCK_H
+
+#include <cmath>
+#include <vector>
+#include "Simulation.h"
+#include "SciantixBatch.h"
+#include "SciantixLane.h"
+#include "SpectralDiffusionKernel.h"
+
+/// SimulationBlock
+/// Arithmetic stages of Simulation on the nodes of a block of the batch (see SciantixBatchTimeStep), computed across the nodes.
+/// The values of the nodes are gathered from their registries (lanes) into arrays over the block, the operations of the method
+/// of Simulation are applied to the arrays and the results are scattered back: every node goes through the operations of
+/// Simulation, in the same order, so the results are the same. The arrays have SpectralDiffusionKernel::batch_nodes entries,
+/// zero after the nodes of the block. The definitions of the models and the other stages stay node by node, on the lanes.
+/// The arithmetic is in double precision: the batch is not computed with the Dual numbers of the sciantix_tangent build.
+
+#ifndef SCIANTIX_TANGENT_DIRECTIONS
+class SimulationBlock
+{
+protected:
+	static const int nodes = SpectralDiffusionKernel::batch_nodes;
+
+	SciantixLane* lanes;
+	int count;
+
+	/// Of the last NewtonBatch call
+	NewtonBatchStatistics statistics;
+
+	/// Values of the nodes, zero after count
+	void getInitialValues(int handle, double values[]) const
+	{
+		for (int k = 0; k < nodes; ++k)
+			values[k] = (k < count) ? lanes[k].sciantix_variable[handle].getInitialValue() : 0.0;
+	}
+
+	void getFinalValues(int handle, double values[]) const
+	{
+		for (int k = 0; k < nodes; ++k)
+			values[k] = (k < count) ? lanes[k].sciantix_variable[handle].getFinalValue() : 0.0;
+	}
+
+	void setFinalValues(int handle, const double values[])
+	{
+		for (int k = 0; k < count; ++k)
+			lanes[k].sciantix_variable[handle].setFinalValue(values[k]);
+	}
+
+	void rescaleFinalValues(int handle, const double factors[])
+	{
+		for (int k = 0; k < count; ++k)
+			lanes[k].sciantix_variable[handle].rescaleFinalValue(factors[k]);
+	}
+
+	void getHistoryValues(int handle, double values[]) const
+	{
+		for (int k = 0; k < nodes; ++k)
+			values[k] = (k < count) ? lanes[k].history_variable[handle].getFinalValue() : 0.0;
+	}
+
+	void getTimeSteps(double values[]) const
+	{
+		for (int k = 0; k < nodes; ++k)
+			values[k] = (k < count) ? lanes[k].physics_variable[pv_time_step].getFinalValue() : 0.0;
+	}
+
+	/// Parameter i of the model of the nodes
+	void getParameters(int model_handle, int i, double values[]) const
+	{
+		for (int k = 0; k < nodes; ++k)
+			values[k] = (k < count) ? lanes[k].model[model_handle].getParameter().at(i) : 0.0;
+	}
+
+	/// With iNewtonWarmStart = 1, the first guesses x of the lanes of NewtonBatch, the nodes node[0, n), are the last converged roots of the nodes
+	/// (the variable root), as with Simulation::getWarmStart. After NewtonBatch, setWarmStarts updates the roots of the lanes converged.
+	void getWarmStarts(int root, int n, const int node[], double x[]) const
+	{
+		if (!lanes[0].input_variable[iv_newton_warm_start].getValue())
+			return;
+
+		for (int i = 0; i < n; ++i)
+			x[i] = NewtonWarmStart<double>(lanes[node[i]].sciantix_variable[root].getInitialValue()).guess(x[i]);
+	}
+
+	template <class Converged>
+	void setWarmStarts(int root, int n, const int node[], const double x[], const Converged& converged)
+	{
+		if (!lanes[0].input_variable[iv_newton_warm_start].getValue())
+			return;
+
+		for (int i = 0; i < n; ++i)
+		{
+			NewtonWarmStart<double> warm_start(lanes[node[i]].sciantix_variable[root].getInitialValue());
+			warm_start.update(x[i], converged(statistics.residual[i]));
+			lanes[node[i]].sciantix_variable[root].setFinalValue(warm_start.getRoot());
+		}
+	}
+
+	/// Volume of the gas in the intergranular bubbles and the vacancies (Simulation::InterGranularBubbleBehaviour)
+	void getIntergranularBubbleVolumes(const double vacancies[], const double schottky_volume[], double volume[]) const
+	{
+		double atoms[nodes];
+
+		for (int k = 0; k < nodes; ++k)
+			volume[k] = 0.0;
+
+		for (auto& system : lanes[0].sciantix_system)
+		{
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			{
+				const double van_der_waals_volume = gas[system.getHandle(System::gas_index)].getVanDerWaalsVolume();
+
+				getFinalValues(system.getHandle(System::intergranular_atoms_per_bubble), atoms);
+				for (int k = 0; k < nodes; ++k)
+					volume[k] += atoms[k] * van_der_waals_volume;
+			}
+		}
+
+		for (int k = 0; k < nodes; ++k)
+			volume[k] += vacancies[k] * schottky_volume[k];
+	}
+
+	/// Sum of the atoms per intergranular bubble of the gases (Simulation::InterGranularBubbleBehaviour)
+	void setIntergranularAtomsPerBubble()
+	{
+		double atoms[nodes], n_at[nodes] = {};
+
+		for (auto& system : lanes[0].sciantix_system)
+		{
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			{
+				getFinalValues(system.getHandle(System::intergranular_atoms_per_bubble), atoms);
+				for (int k = 0; k < nodes; ++k)
+					n_at[k] += atoms[k];
+			}
+		}
+
+		setFinalValues(sv_intergranular_atoms_per_bubble, n_at);
+	}
+
+	/// Modes of the section of the nodes [first, first + count) of the batch, stored by mode (see SpectralDiffusionKernel::batch_nodes),
+	/// zero for the nodes after count
+	template <class State>
+	void getSectionModes(SciantixBatchOf<State>& batch, int first, int section, double modes[]) const
+	{
+		for (int n = 0; n < n_modes; ++n)
+		{
+			const State* node_modes = &batch.diffusion_modes(section * n_modes + n)[first];
+			for (int k = 0; k < nodes; ++k)
+				modes[n * nodes + k] = (k < count) ? node_modes[k] : 0.0;
+		}
+	}
+
+	template <class State>
+	void setSectionModes(SciantixBatchOf<State>& batch, int first, int section, const double modes[]) const
+	{
+		for (int n = 0; n < n_modes; ++n)
+		{
+			State* node_modes = &batch.diffusion_modes(section * n_modes + n)[first];
+			for (int k = 0; k < count; ++k)
+				node_modes[k] = static_cast<State>(modes[n * nodes + k]);
+		}
+	}
+
+public:
+	/// Simulation::Burnup
+	void Burnup()
+	{
+		double burnup_initial[nodes], source[nodes], time_step[nodes], burnup[nodes];
+		getInitialValues(sv_burnup, burnup_initial);
+		getParameters(sm_burnup, 0, source);
+		getTimeSteps(time_step);
+
+		for (int k = 0; k < nodes; ++k)
+			burnup[k] = solver.Integrator(burnup_initial[k], source[k], time_step[k]);
+
+		setFinalValues(sv_burnup, burnup);
+
+		double fission_rate[nodes], specific_power[nodes], time_initial[nodes], time[nodes];
+		getHistoryValues(hv_fission_rate, fission_rate);
+		getFinalValues(sv_specific_power, specific_power);
+		getInitialValues(sv_irradiation_time, time_initial);
+
+		for (int k = 0; k < nodes; ++k)
+			time[k] = (fission_rate[k] > 0.0) ?
+				solver.Integrator(time_initial[k], 1.0 / specific_power[k], 24.0 * (burnup[k] - burnup_initial[k])) :
+				time_initial[k];
+
+		setFinalValues(sv_irradiation_time, time);
+
+		double fima_initial[nodes], u[nodes], fima[nodes];
+		getInitialValues(sv_fima, fima_initial);
+		getFinalValues(sv_u, u);
+
+		for (int k = 0; k < nodes; ++k)
+			fima[k] = solver.Integrator(fima_initial[k], fission_rate[k] * 3.6e5 / u[k], time[k] - time_initial[k]);
+
+		setFinalValues(sv_fima, fima);
+	}
+
+	/// Simulation::EffectiveBurnup
+	void EffectiveBurnup()
+	{
+		double initial[nodes], source[nodes], time_step[nodes], effective_burnup[nodes];
+		getInitialValues(sv_effective_burnup, initial);
+		getParameters(sm_effective_burnup, 0, source);
+		getTimeSteps(time_step);
+
+		for (int k = 0; k < nodes; ++k)
+			effective_burnup[k] = solver.Integrator(initial[k], source[k], time_step[k]);
+
+		setFinalValues(sv_effective_burnup, effective_burnup);
+	}
+
+	/// Simulation::UO2Thermochemistry, the equations of the nodes above 1000 K with oxygen in the gap solved together
+	/// (NewtonBatch, as Solver::NewtonBlackburn)
+	void UO2Thermochemistry()
+	{
+		if (!lanes[0].input_variable[iv_stoichiometry_deviation].getValue()) return;
+
+		const double tol(1.0e-3);
+		const int max_iter(50);
+
+		double temperature[nodes], gap_pressure[nodes], equilibrium[nodes] = {};
+		getHistoryValues(hv_temperature, temperature);
+		getFinalValues(sv_gap_oxygen_partial_pressure, gap_pressure);
+
+		int node[nodes], n(0);
+		double x[nodes], b[nodes], c[nodes];
+		for (int k = 0; k < count; ++k)
+		{
+			if (temperature[k] < 1000.0 || gap_pressure[k] == 0)
+				continue;
+
+			const std::vector<Real>& parameter = lanes[k].model[sm_uo2_thermochemistry].getParameter();
+			node[n] = k;
+			x[n] = (parameter.at(0) == 0.0) ? 1.0e-7 : parameter.at(0);
+			b[n] = parameter.at(1);
+			c[n] = log(parameter.at(2));
+			++n;
+		}
+
+		getWarmStarts(sv_uo2_thermochemistry_newton_root, n, node, x);
+
+		const IntegerResidual converged(tol);
+		NewtonBatch(n, x,
+			[&](int i, double x) { return 2.0*log(x*(x+2.0)/(1.0-x)) + 108.0*pow(x,2.0) - 32700.0/b[i] + 9.92 - c[i]; },
+			[&](int, double x) { return 216.0*x + 2.0*(pow(x,2.0)-2.0*x-2.0)/((x-1.0)*x*(2.0+x)); },
+			converged,
+			NewtonSettings(max_iter), statistics);
+
+		setWarmStarts(sv_uo2_thermochemistry_newton_root, n, node, x, converged);
+
+		for (int i = 0; i < n; ++i)
+			equilibrium[node[i]] = x[i];
+
+		setFinalValues(sv_equilibrium_stoichiometry_deviation, equilibrium);
+	}
+
+	/// Simulation::StoichiometryDeviation, the equations of the Langmuir-based model (iStoichiometryDeviation > 4) of the nodes
+	/// above 1000 K solved together (NewtonBatch, as Solver::NewtonLangmuirBasedModel)
+	void StoichiometryDeviation()
+	{
+		const double setting = lanes[0].input_variable[iv_stoichiometry_deviation].getValue();
+		if (!setting) return;
+
+		const double tol(1.0e-3);
+		const int max_iter(50);
+
+		double temperature[nodes], initial[nodes], time_step[nodes], deviation[nodes], pressure[nodes];
+		getHistoryValues(hv_temperature, temperature);
+		getInitialValues(sv_stoichiometry_deviation, initial);
+		getTimeSteps(time_step);
+
+		int node[nodes], n(0);
+		double x[nodes], K[nodes], beta[nodes], alpha[nodes], increment[nodes];
+		for (int k = 0; k < count; ++k)
+		{
+			const std::vector<Real>& parameter = lanes[k].model[sm_stoichiometry_deviation].getParameter();
+
+			if (temperature[k] < 1000.0)
+				deviation[k] = initial[k];
+
+			else if (setting < 5)
+				deviation[k] = solver.Decay(initial[k], parameter.at(0), parameter.at(1), time_step[k]);
+
+			else
+			{
+				node[n] = k;
+				x[n] = initial[k];
+				K[n] = parameter.at(0);
+				beta[n] = parameter.at(1);
+				alpha[n] = parameter.at(2);
+				increment[n] = time_step[k];
+				++n;
+			}
+		}
+
+		getWarmStarts(sv_stoichiometry_deviation_newton_root, n, node, x);
+
+		const IntegerResidual converged(tol);
+		NewtonBatch(n, x,
+			[&](int i, double x) { return x - initial[node[i]] - K[i] * increment[i] + K[i] * beta[i] * exp(alpha[i] * x) * increment[i]; },
+			[&](int i, double x) { return 1.0 + K[i] * beta[i] * alpha[i] * exp(alpha[i] * x) * increment[i]; },
+			converged,
+			NewtonSettings(max_iter), statistics);
+
+		setWarmStarts(sv_stoichiometry_deviation_newton_root, n, node, x, converged);
+
+		for (int i = 0; i < n; ++i)
+			deviation[node[i]] = x[i];
+
+		for (int k = 0; k < count; ++k)
+			pressure[k] = BlackburnThermochemicalModel(deviation[k], temperature[k]);
+
+		setFinalValues(sv_stoichiometry_deviation, deviation);
+		setFinalValues(sv_fuel_oxygen_partial_pressure, pressure);
+	}
+
+	/// Simulation::GrainGrowth, the quartic equations of the nodes solved together (NewtonBatch, as Solver::QuarticEquation)
+	void GrainGrowth()
+	{
+		const double tol(1.0e-3);
+		const int max_iter(5);
+
+		int node[nodes];
+		double radius[nodes], a[nodes], b[nodes], c[nodes], d[nodes], e[nodes];
+		getParameters(sm_grain_growth, 0, radius);
+		getParameters(sm_grain_growth, 1, a);
+		getParameters(sm_grain_growth, 2, b);
+		getParameters(sm_grain_growth, 3, c);
+		getParameters(sm_grain_growth, 4, d);
+		getParameters(sm_grain_growth, 5, e);
+
+		for (int k = 0; k < nodes; ++k)
+			node[k] = k;
+
+		getWarmStarts(sv_grain_growth_newton_root, count, node, radius);
+
+		auto converged = [&](double function) { return function < tol; };
+		NewtonBatch(count, radius,
+			[&](int i, double y) { return a[i]*pow(y, 4) + b[i]*pow(y, 3) + c[i]*pow(y, 2) + d[i]*y + e[i]; },
+			[&](int i, double y) { return 4.0*a[i]*pow(y, 3) + 3.0*b[i]*pow(y, 2) + 2.0*c[i]*y + d[i]; },
+			converged,
+			NewtonSettings(max_iter), statistics);
+
+		setWarmStarts(sv_grain_growth_newton_root, count, node, radius, converged);
+
+		setFinalValues(sv_grain_radius, radius);
+
+		for (int k = 0; k < count; ++k)
+			lanes[k].matrix[sma_uo2].setGrainRadius(radius[k]);
+	}
+
+	/// Simulation::IntraGranularBubbleBehaviour
+	void IntraGranularBubbleBehaviour()
+	{
+		double initial[nodes], rate[nodes], source[nodes], time_step[nodes], concentration[nodes];
+		getInitialValues(sv_intragranular_bubble_concentration, initial);
+		getParameters(sm_intragranular_bubble_evolution, 0, rate);
+		getParameters(sm_intragranular_bubble_evolution, 1, source);
+		getTimeSteps(time_step);
+
+		for (int k = 0; k < nodes; ++k)
+			concentration[k] = solver.Decay(initial[k], rate[k], source[k], time_step[k]);
+
+		setFinalValues(sv_intragranular_bubble_concentration, concentration);
+
+		// Atom per bubbles and bubble volume
+		double volume[nodes], in_bubbles[nodes], atoms[nodes], volume_in_lattice[nodes];
+		getFinalValues(sv_intragranular_bubble_volume, volume);
+
+		for (std::size_t s = 0; s < lanes[0].sciantix_system.size(); ++s)
+		{
+			System& system = lanes[0].sciantix_system[s];
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+			{
+				getFinalValues(system.getHandle(System::in_intragranular_bubbles), in_bubbles);
+				for (int k = 0; k < nodes; ++k)
+				{
+					atoms[k] = (concentration[k] > 0.0) ? in_bubbles[k] / concentration[k] : 0.0;
+					volume_in_lattice[k] = (k < count) ? lanes[k].sciantix_system[s].getVolumeInLattice() : 0.0;
+				}
+				setFinalValues(system.getHandle(System::intragranular_atoms_per_bubble), atoms);
+
+				for (int k = 0; k < nodes; ++k)
+					volume[k] += volume_in_lattice[k] * atoms[k];
+			}
+		}
+
+		setFinalValues(sv_intragranular_bubble_volume, volume);
+
+		// Intragranular bubble radius and swelling
+		double radius[nodes], swelling[nodes];
+		for (int k = 0; k < nodes; ++k)
+		{
+			radius[k] = 0.620350491 * pow(volume[k], (1.0 / 3.0));
+			swelling[k] = 4.188790205 * pow(radius[k], 3) * concentration[k];
+		}
+
+		setFinalValues(sv_intragranular_bubble_radius, radius);
+		setFinalValues(sv_intragranular_gas_bubble_swelling, swelling);
+
+		double helium_initial[nodes], helium[nodes], similarity_ratio[nodes];
+		getInitialValues(sv_he_in_intragranular_bubbles, helium_initial);
+		getFinalValues(sv_he_in_intragranular_bubbles, helium);
+
+		for (int k = 0; k < nodes; ++k)
+			similarity_ratio[k] = (helium_initial[k] > 0.0) ? sqrt(helium[k] / helium_initial[k]) : 0.0;
+
+		setFinalValues(sv_intragranular_similarity_ratio, similarity_ratio);
+	}
+
+	/// Simulation::InterGranularBubbleBehaviour
+	void InterGranularBubbleBehaviour()
+	{
+		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
+
+		double schottky_volume[nodes], shape_factor[nodes], sin_angle[nodes];
+		for (int k = 0; k < nodes; ++k)
+		{
+			Matrix* fuel = (k < count) ? &lanes[k].matrix[sma_uo2] : nullptr;
+			schottky_volume[k] = fuel ? fuel->getSchottkyVolume() : 0.0;
+			shape_factor[k] = fuel ? fuel->getLenticularShapeFactor() : 0.0;
+			sin_angle[k] = fuel ? sin(fuel->getSemidihedralAngle()) : 0.0;
+		}
+
+		// Vacancy concentration
+		double vacancies[nodes], growth_rate[nodes], source[nodes], time_step[nodes];
+		getInitialValues(sv_intergranular_vacancies_per_bubble, vacancies);
+		getParameters(sm_intergranular_bubble_evolution, 0, growth_rate);
+		getParameters(sm_intergranular_bubble_evolution, 1, source);
+		getTimeSteps(time_step);
+
+		for (int k = 0; k < nodes; ++k)
+			vacancies[k] = solver.LimitedGrowth(vacancies[k], growth_rate[k], source[k], time_step[k]);
+
+		setFinalValues(sv_intergranular_vacancies_per_bubble, vacancies);
+
+		// Grain-boundary bubble volume, radius and area
+		double volume[nodes], radius[nodes], area_initial[nodes], area[nodes];
+		getIntergranularBubbleVolumes(vacancies, schottky_volume, volume);
+		getInitialValues(sv_intergranular_bubble_area, area_initial);
+
+		for (int k = 0; k < nodes; ++k)
+		{
+			radius[k] = 0.620350491 * pow(volume[k] / (shape_factor[k]), 1. / 3.);
+			area[k] = pi * pow(radius[k] * sin_angle[k], 2);
+		}
+
+		// Grain-boundary bubble coalescence
+		double concentration_initial[nodes], concentration[nodes], conservation[nodes];
+		getInitialValues(sv_intergranular_bubble_concentration, concentration_initial);
+
+		for (int k = 0; k < nodes; ++k)
+		{
+			concentration[k] = solver.BinaryInteraction(concentration_initial[k], 2.0, area[k] - area_initial[k]);
+			conservation[k] = concentration_initial[k] / concentration[k];
+		}
+
+		setFinalValues(sv_intergranular_bubble_concentration, concentration);
+
+		// Conservation
+		for (auto& system : lanes[0].sciantix_system)
+		{
+			if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+				rescaleFinalValues(system.getHandle(System::intergranular_atoms_per_bubble), conservation);
+		}
+
+		setIntergranularAtomsPerBubble();
+
+		for (int k = 0; k < nodes; ++k)
+			vacancies[k] *= conservation[k];
+
+		setFinalValues(sv_intergranular_vacancies_per_bubble, vacancies);
+
+		getIntergranularBubbleVolumes(vacancies, schottky_volume, volume);
+
+		// Fractional coverage
+		double coverage[nodes], saturation_coverage[nodes], similarity_ratio[nodes];
+		getFinalValues(sv_intergranular_saturation_fractional_coverage, saturation_coverage);
+
+		for (int k = 0; k < nodes; ++k)
+		{
+			radius[k] = 0.620350491 * pow(volume[k] / (shape_factor[k]), 1. / 3.);
+			area[k] = pi * pow(radius[k] * sin_angle[k], 2);
+			coverage[k] = area[k] * concentration[k];
+
+			// Intergranular gas release
+			similarity_ratio[k] = (coverage[k] > 0.0) ? sqrt(saturation_coverage[k] / coverage[k]) : 1.0;
+		}
+
+		// Nodes at saturation: the factors are 1 for the others (the values do not change)
+		double atoms_ratio[nodes], at_grain_boundary_ratio[nodes];
+		bool saturation = false;
+
+		for (int k = 0; k < nodes; ++k)
+		{
+			atoms_ratio[k] = 1.0;
+			at_grain_boundary_ratio[k] = 1.0;
+
+			if (similarity_ratio[k] < 1.0)
+			{
+				area[k] *= similarity_ratio[k];
+				concentration[k] *= similarity_ratio[k];
+				coverage[k] *= pow(similarity_ratio[k], 2);
+				volume[k] *= pow(similarity_ratio[k], 1.5);
+				radius[k] *= pow(similarity_ratio[k], 0.5);
+				vacancies[k] *= pow(similarity_ratio[k], 1.5);
+				atoms_ratio[k] = pow(similarity_ratio[k], 1.5);
+				at_grain_boundary_ratio[k] = pow(similarity_ratio[k], 2.5);
+				saturation |= (k < count);
+			}
+		}
+
+		setFinalValues(sv_intergranular_bubble_volume, volume);
+		setFinalValues(sv_intergranular_bubble_radius, radius);
+		setFinalValues(sv_intergranular_bubble_area, area);
+		setFinalValues(sv_intergranular_bubble_concentration, concentration);
+		setFinalValues(sv_intergranular_fractional_coverage, coverage);
+		setFinalValues(sv_intergranular_vacancies_per_bubble, vacancies);
+
+		if (saturation)
+		{
+			// New intergranular gas concentration
+			for (auto& system : lanes[0].sciantix_system)
+			{
+				if (gas[system.getHandle(System::gas_index)].getDecayRate() == 0.0 && system.getRestructuredMatrix() == 0)
+					rescaleFinalValues(system.getHandle(System::intergranular_atoms_per_bubble), atoms_ratio);
+			}
+
+			setIntergranularAtomsPerBubble();
+
+			for (auto& system : lanes[0].sciantix_system)
+			{
+				if (system.getRestructuredMatrix() == 0)
+					rescaleFinalValues(system.getHandle(System::at_grain_boundary), at_grain_boundary_ratio);
+			}
+		}
+
+		// Calculation of the gas concentration arrived at the grain boundary, by mass balance.
+		double produced[nodes], decayed[nodes], in_grain[nodes], at_grain_boundary[nodes], released[nodes];
+		for (auto& system : lanes[0].sciantix_system)
+		{
+			if (system.getRestructuredMatrix() == 0)
+			{
+				getFinalValues(system.getHandle(System::produced), produced);
+				getFinalValues(system.getHandle(System::decayed), decayed);
+				getFinalValues(system.getHandle(System::in_grain), in_grain);
+				getFinalValues(system.getHandle(System::at_grain_boundary), at_grain_boundary);
+
+				for (int k = 0; k < nodes; ++k)
+				{
+					released[k] = produced[k] - decayed[k] - in_grain[k] - at_grain_boundary[k];
+					if (released[k] < 0.0)
+						released[k] = 0.0;
+				}
+
+				setFinalValues(system.getHandle(System::released), released);
+			}
+		}
+
+		// Intergranular gaseous swelling
+		double grain_radius[nodes], swelling[nodes];
+		getFinalValues(sv_grain_radius, grain_radius);
+
+		for (int k = 0; k < nodes; ++k)
+			swelling[k] = 3 / grain_radius[k] * concentration[k] * volume[k];
+
+		setFinalValues(sv_intergranular_gas_swelling, swelling);
+	}
+
+	/// Rounding of the modes (iStatePrecision = 1), grain-boundary sweeping, gas produced and decayed (Simulation::DiffusionModesRounding,
+	/// GrainBoundarySweeping, GasProduction, GasDecay) and spectral diffusion of the systems (Simulation::GasDiffusion, up to the gas in grain,
+	/// then completed node by node with solved_modes), in the same order for each section of the modes.
+	/// The modes are advanced in the arrays of the batch.
+	template <class State>
+	void GasDiffusion(SciantixBatchOf<State>& batch, int first, const int Sciantix_options[])
+	{
+		const double first_mode_projection = SpectralModeTable::get(n_modes).projection[0] / ((4.0 / 3.0) * CONSTANT_NUMBERS_H::MathConstants::pi);
+
+		const bool rounding = (Sciantix_options[30] == 1);
+
+		// Switch and section of the modes of Simulation::GrainBoundarySweeping
+		const bool sweeping = (Sciantix_options[0] != 0);
+		const int swept_section = 6;
+		bool swept = false;
+
+		double modes[n_modes * nodes];
+		double initial[nodes] = {}, rate[nodes] = {}, source[nodes] = {}, increment[nodes] = {}, value[nodes] = {}, projection[nodes];
+
+		for (std::size_t s = 0; s < lanes[0].sciantix_system.size(); ++s)
+		{
+			System& system = lanes[0].sciantix_system[s];
+			const int restructured = system.getRestructuredMatrix();
+			if (restructured != 0 && restructured != 1)
+				continue;
+
+			const int production_model = system.getHandle(System::gas_production_model);
+			const int diffusion_model = system.getHandle(System::gas_diffusion_model);
+			const int produced = system.getHandle(restructured == 0 ? System::produced : System::produced_in_hbs);
+			const int in_grain = system.getHandle(restructured == 0 ? System::in_grain : System::in_grain_hbs);
+			const int section = system.getHandle(System::diffusion_modes_section);
+
+			// Gas produced (Simulation::GasProduction)
+			getInitialValues(produced, initial);
+			getParameters(production_model, 0, rate);
+			getParameters(production_model, 1, increment);
+			for (int k = 0; k < nodes; ++k)
+				value[k] = solver.Integrator(initial[k], rate[k], increment[k]);
+			setFinalValues(produced, value);
+
+			// Gas decayed (Simulation::GasDecay)
+			const double decay_rate = gas[system.getHandle(System::gas_index)].getDecayRate();
+			if (decay_rate > 0.0 && restructured == 0)
+			{
+				const int decayed = system.getHandle(System::decayed);
+
+				getInitialValues(decayed, initial);
+				getFinalValues(produced, source);
+				getTimeSteps(increment);
+				for (int k = 0; k < nodes; ++k)
+					value[k] = solver.Decay(initial[k], decay_rate, decay_rate * source[k], increment[k]);
+				setFinalValues(decayed, value);
+			}
+
+			if (section < 0)
+				continue;
+
+			getSectionModes(batch, first, section, modes);
+
+			// Modes consistent with the gas in grain (Simulation::DiffusionModesRounding)
+			if (rounding)
+			{
+				getFinalValues(in_grain, value);
+
+				SpectralDiffusionKernel::ProjectionNodes(modes, n_modes, projection);
+				for (int k = 0; k < nodes; ++k)
+					modes[k] += (value[k] - projection[k]) / first_mode_projection;
+			}
+
+			// Simulation::GrainBoundarySweeping
+			if (sweeping && section == swept_section)
+			{
+				getParameters(sm_grain_boundary_sweeping, 0, rate);
+				for (int i = 0; i < n_modes * nodes; ++i)
+					modes[i] = solver.Decay(modes[i], 1.0, 0.0, rate[i % nodes]);
+
+				swept = true;
+			}
+
+			// Spectral diffusion (Simulation::GasDiffusion, Solver::SpectralDiffusion)
+			double diffusion_rate_coeff[nodes] = {}, source_rate_coeff[nodes] = {}, loss_rate[nodes] = {};
+			for (int k = 0; k < count; ++k)
+				solver.SpectralDiffusionRates(lanes[k].model[diffusion_model].getParameter(), diffusion_rate_coeff[k], source_rate_coeff[k]);
+			getParameters(diffusion_model, 4, loss_rate);
+			getTimeSteps(increment);
+
+			const int diffusion_modes = int(lanes[0].model[diffusion_model].getParameter().at(0));
+			SpectralDiffusionKernel::DecayNodes(modes, diffusion_modes, diffusion_rate_coeff, loss_rate, source_rate_coeff, increment);
+			SpectralDiffusionKernel::ProjectionNodes(modes, diffusion_modes, projection);
+
+			setFinalValues(in_grain, projection);
+
+			setSectionModes(batch, first, section, modes);
+		}
+
+		// Section swept without a system
+		if (sweeping && !swept)
+		{
+			getSectionModes(batch, first, swept_section, modes);
+
+			getParameters(sm_grain_boundary_sweeping, 0, rate);
+			for (int i = 0; i < n_modes * nodes; ++i)
+				modes[i] = solver.Decay(modes[i], 1.0, 0.0, rate[i % nodes]);
+
+			setSectionModes(batch, first, swept_section, modes);
+		}
+	}
+
+	/// Arithmetic stages of the nodes of lanes[0, count), a block of the batch
+	SimulationBlock(SciantixLane lanes[], int count) : lanes(lanes), count(count) { }
+	~SimulationBlock() { }
+};
+#endif
+
+#endif // SIMULATION_BLOCK_H
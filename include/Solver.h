@@ -20,32 +20,45 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <algorithm>
 #include "InputVariable.h"
 #include "ConstantNumbers.h"
+#include "Real.h"
+#include "SpectralDiffusionKernel.h"
+#include "Tracing.h"
+#include "NewtonSolver.h"
+#include "Profiling.h"
 
 /// Derived class for the SCIANTIX solvers. They are communicated with models within the Simulation class.
+/// The calls of the spectral and iterative solvers are traced (iTrace = 1); the closed-form ones are part of the events of their stage.
+/// The arithmetic is on Real: double, or a forward-mode Dual number in the sciantix_tangent build (Real.h).
 
 class Solver : public InputVariable
 {
 public:
 
-	double Integrator(double initial_value, double parameter, double increment)
+	Real Integrator(Real initial_value, Real parameter, Real increment)
 	{
 		/// Solver for the ODE [y' = + S]
 		// parameter = source term
 		return initial_value + parameter * increment;
 	}
 
-	double LimitedGrowth(double initial_value, std::vector<double> parameter, double increment)
+	Real LimitedGrowth(Real initial_value, std::vector<Real> parameter, Real increment)
 	{
 		/// Solver for the ODE [y' = k / y + S]
 		// parameter[0] = growth rate
 		// parameter[1] = source term
-		return 0.5 * ((initial_value + parameter[1] * increment) + sqrt(pow(initial_value + parameter[1] * increment, 2) + 4.0 * parameter[0] * increment));
+		return LimitedGrowth(initial_value, parameter[0], parameter[1], increment);
+	}
+
+	Real LimitedGrowth(Real initial_value, Real growth_rate, Real source_term, Real increment)
+	{
+		return 0.5 * ((initial_value + source_term * increment) + sqrt(pow(initial_value + source_term * increment, 2) + 4.0 * growth_rate * increment));
 	}
 
 	//double Decay(double initial_condition, std::vector<double> parameter, double increment)
-	double Decay(double initial_condition, double decay_rate, double source_term, double increment)
+	Real Decay(Real initial_condition, Real decay_rate, Real source_term, Real increment)
 	{
 		/// Solver for the ODE [y' = - L y + S]
 		/// 1nd parameter = decay rate
@@ -53,7 +66,7 @@ public:
 		return (initial_condition + source_term * increment) / (1.0 + decay_rate * increment);
 	}
 
-	double BinaryInteraction(double initial_condition, double interaction_coefficient, double increment)
+	Real BinaryInteraction(Real initial_condition, Real interaction_coefficient, Real increment)
 		/// Solver for the ODE [y' = -k y**2]
 	{
 		/*
@@ -65,12 +78,15 @@ public:
 		return initial_condition / (1.0 + interaction_coefficient * initial_condition * increment);
 	}
 
-	double SpectralDiffusion(double* initial_condition, std::vector<double> parameter, double increment)
+	Real SpectralDiffusion(Real* initial_condition, const std::vector<Real>& parameter, Real increment)
 	{
 		/// Solver for the spatially averaged solution of the PDE [dy/dt = D div grad y + S - L y]
 		/// We apply a spectral approach in space, projecting the equation on the eigenfunctions of the laplacian operator.
-		/// We use the first order backward Euler solver in time.
-		/// The number of terms in the expansion, N, is fixed a priori.
+		/// We use the first order backward Euler solver in time, or the exact solution over the time step
+		/// with constant coefficients (exponential integrator).
+		/// The number of terms in the expansion, N, is fixed a priori (iDiffusionModes); the highest ones can be truncated
+		/// at each time step, when negligible (iAdaptiveModes, see ActiveDiffusionModes).
+		/// The modes are advanced by SpectralDiffusionKernel, on the mode tables of SpectralModeTable.
 
 		// Parameters
 		// 0) N_modes
@@ -78,51 +94,75 @@ public:
 		// 2) r
 		// 3) production
 		// 4) loss rate
+		// 5) time integrator (0 = backward Euler, 1 = exponential)
+		// 6) truncation tolerance of the modes (0 = all the modes)
 
-		unsigned short int n(0);
-		unsigned short int np1(1);
+		TraceScope trace("Solver::SpectralDiffusion", "solver");
+
+		Real diffusion_rate_coeff, source_rate_coeff;
+		SpectralDiffusionRates(parameter, diffusion_rate_coeff, source_rate_coeff);
+
+		Real* const modes[1] = { initial_condition };
+		const int n_modes = ActiveDiffusionModes(modes, 1, Value(parameter.at(0)), diffusion_rate_coeff, &source_rate_coeff, increment, parameter.at(6));
+
+		if (parameter.at(5) == 1.0)
+			SpectralDiffusionKernel::ExponentialDecay(initial_condition, n_modes, diffusion_rate_coeff, parameter.at(4), source_rate_coeff, increment);
+		else
+			SpectralDiffusionKernel::Decay(initial_condition, n_modes, diffusion_rate_coeff, parameter.at(4), source_rate_coeff, increment);
+
+		return SpectralDiffusionKernel::Projection(initial_condition, n_modes);
+	}
+
+	void SpectralDiffusionRates(const std::vector<Real>& parameter, Real& diffusion_rate_coeff, Real& source_rate_coeff)
+	{
+		/// Coefficients of the rates of the modes of SpectralDiffusion (same parameters):
+		/// diffusion_rate_coeff = pi^2 D / r^2, source_rate_coeff = projection_coeff * production.
+		/// Also used by the batches, which advance the modes of several nodes at once (see SciantixBatch).
 
-		double diffusion_rate_coeff(0.0);
-		double diffusion_rate(0.0);
-		double source_rate_coeff(0.0);
-		double source_rate(0.0);
-		double projection_coeff(0.0);
-		double solution(0.0);
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
 		diffusion_rate_coeff = pow(pi, 2) * parameter.at(1) / pow(parameter.at(2), 2);
-		projection_coeff = -2.0 * sqrt(2.0 / pi);
+		double projection_coeff = -2.0 * sqrt(2.0 / pi);
 		source_rate_coeff = projection_coeff * parameter.at(3);
+	}
 
-		for (n = 0; n < parameter.at(0); n++)
-		{
-			np1 = n + 1;
-			const double n_coeff = pow(-1.0, np1) / np1;
+	int ActiveDiffusionModes(Real* const modes[], int n_arrays, int n_modes, Real diffusion_rate_coeff, const Real source_rate_coeff[], Real increment, Real tolerance)
+	{
+		/// Number of modes advanced by the spectral solvers over the time step: all of them, or the ones left by the truncation
+		/// of the negligible highest modes of the coupled arrays (tolerance > 0, see SpectralDiffusionKernel::ActiveModes).
+		/// diffusion_rate_coeff: pi^2 D / a^2, with the effective diffusivity of the coupled populations.
+		/// The modes advanced are counted in the profile (iProfiling = 1).
 
-			diffusion_rate = diffusion_rate_coeff * pow(np1, 2) + parameter.at(4);
-			source_rate = source_rate_coeff * n_coeff;
+		int active_modes = n_modes;
+		if (Value(tolerance) > 0.0)
+			active_modes = SpectralDiffusionKernel::ActiveModes(modes, n_arrays, n_modes, diffusion_rate_coeff, source_rate_coeff, increment, Value(tolerance));
 
-			initial_condition[n] = Solver::Decay(initial_condition[n], diffusion_rate, source_rate, increment);
+		CountDiffusionModes(active_modes, n_modes);
+		return active_modes;
+	}
 
-			solution += projection_coeff * n_coeff * initial_condition[n] / ((4. / 3.) * pi);
-		}
+	Real EffectiveDiffusivity(Real diffusivity_solution, Real diffusivity_bubbles, Real resolution_rate, Real trapping_rate)
+	{
+		/// Diffusivity of the gas in solution and in intragranular bubbles at equilibrium (as in the single equation model)
+		if (resolution_rate + trapping_rate > 0.0)
+			return (resolution_rate * diffusivity_solution + trapping_rate * diffusivity_bubbles) / (resolution_rate + trapping_rate);
 
-		return solution;
+		return std::min(diffusivity_solution, diffusivity_bubbles);
 	}
 
-	double dotProduct1D(std::vector<double> u, double v[], int n)
+	Real dotProduct1D(std::vector<Real> u, Real v[], int n)
 	{
 		/// Function to compute the dot product between two arrays (v and u) of size n
-		double result = 0.0;
+		Real result = 0.0;
 		for (int i = 0; i < n; ++i)
 			result += u[i] * v[i];
 		return result;
 	}
 
-	void dotProduct2D(double A[], double v[], int n_rows, const int n_col, double result[])
+	void dotProduct2D(Real A[], Real v[], int n_rows, const int n_col, Real result[])
 	{
 		/// Function to compute the dot product between a matrix and an array
-		std::vector<double> a(n_col);
+		std::vector<Real> a(n_col);
 		for (int i = 0; i < n_rows; ++i)
 		{
 			// create a vector from the i-th row of A
@@ -134,163 +174,178 @@ public:
 		}
 	}
 
-	void SpectralDiffusion2equations(double& gas_1, double& gas_2, double* initial_condition_gas_1, double* initial_condition_gas_2, std::vector<double> parameter, double increment)
+	template <int N>
+	void SpectralDiffusionNequations(Real gas[N], Real* const initial_condition[N], int n_modes, const Real diffusivity[N], Real grain_radius, const Real production[N], const Real rate_matrix[N * N], Real increment)
 	{
-		unsigned short int n(0);
-		unsigned short int np1(1);
+		/// Solver for the spatially averaged solutions of N coupled PDEs [dy_i/dt = D_i div grad y_i + S_i - sum_j K_ij y_j],
+		/// N = 2 ... SpectralDiffusionKernel::max_coupled_equations: populations of gas (in solution, in bubbles, in the HBS, in traps)
+		/// exchanging atoms by trapping, resolution, sweeping.
+		/// Same spectral approach of SpectralDiffusion, with the first order backward Euler solver in time:
+		/// the N x N system of each mode is solved by Gaussian elimination, on blocks of modes (SpectralDiffusionKernel::DecayNEquations).
+		/// rate_matrix: K (1/s), row-major, loss rates on the diagonal and minus the transfer rates from the population j to i off it.
 
-		double diffusion_rate1(0.0);
-		double diffusion_rate2(0.0);
+		static_assert(N >= 2 && N <= SpectralDiffusionKernel::max_coupled_equations, "SpectralDiffusionKernel::DecayNEquations is instantiated for N = 2 ... max_coupled_equations");
 
-		double diffusion_rate_coeff1(0.0);
-		double diffusion_rate_coeff2(0.0);
+		TraceScope trace("Solver::SpectralDiffusionNequations", "solver");
 
-		double source_rate1(0.0);
-		double source_rate2(0.0);
+		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
+		double projection_coeff = - 2.0 * sqrt(2.0 / pi);
 
-		double source_rate_coeff_1(0.0);
-		double source_rate_coeff_2(0.0);
+		Real diffusion_rate_coeff[N], source_rate_coeff[N];
+		for (int i = 0; i < N; ++i)
+		{
+			diffusion_rate_coeff[i] = pow(pi, 2) * diffusivity[i] / pow(grain_radius, 2);
+			source_rate_coeff[i] = projection_coeff * production[i];
+		}
 
-		double projection_coeff(0.0);
+		SpectralDiffusionKernel::DecayNEquations<N>(initial_condition, n_modes, diffusion_rate_coeff, source_rate_coeff, rate_matrix, increment);
 
-		double gas_1_solution(0.);
-		double gas_2_solution(0.);
+		for (int i = 0; i < N; ++i)
+			gas[i] = SpectralDiffusionKernel::Projection(initial_condition[i], n_modes);
+	}
 
-		double coeff_matrix[4];
-		double initial_conditions[2];
+	void SpectralDiffusion2equations(Real& gas_1, Real& gas_2, Real* initial_condition_gas_1, Real* initial_condition_gas_2, const std::vector<Real>& parameter, Real increment)
+	{
+		/// Gas in solution (1) and in intragranular bubbles (2)
 
-		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
+		// Parameters
+		// 0) N_modes
+		// 1-2) D1, D2
+		// 3) r
+		// 4-5) production S1, S2
+		// 6) resolution rate
+		// 7) trapping rate
+		// 8) decay rate
+		// 9) time integrator (0 = backward Euler, 1 = exponential)
+		// 10) truncation tolerance of the modes (0 = all the modes)
 
-		diffusion_rate_coeff1 = pow(pi, 2) * parameter.at(1) / pow(parameter.at(3), 2); // pi^2 * D1 / a^2
-		diffusion_rate_coeff2 = pow(pi, 2) * parameter.at(2) / pow(parameter.at(3), 2); // pi^2 * D2 / a^2
+		TraceScope trace("Solver::SpectralDiffusion2equations", "solver");
 
-		projection_coeff = - 2.0 * sqrt(2.0 / pi);
+		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
-		source_rate_coeff_1 = projection_coeff * parameter.at(4); // - 2 sqrt(2/pi) * S1
-		source_rate_coeff_2 = projection_coeff * parameter.at(5); // - 2 sqrt(2/pi) * S2
+		Real* const modes[2] = { initial_condition_gas_1, initial_condition_gas_2 };
+		const Real source_rate_coeff[2] = { - 2.0 * sqrt(2.0 / pi) * parameter.at(4), - 2.0 * sqrt(2.0 / pi) * parameter.at(5) };
+		const int n_modes = ActiveDiffusionModes(modes, 2, Value(parameter.at(0)),
+			pow(pi, 2) * EffectiveDiffusivity(parameter.at(1), parameter.at(2), parameter.at(6), parameter.at(7)) / pow(parameter.at(3), 2),
+			source_rate_coeff, increment, parameter.at(10));
 
-		for (n = 0; n < parameter.at(0); n++)
+		if (parameter.at(9) == 1.0)
 		{
-			np1 = n + 1;
-			const double n_coeff = pow(-1.0, np1) / np1;
-
-			diffusion_rate1 = diffusion_rate_coeff1 * pow(np1, 2); // pi^2 * D1 * n^2 / a^2
-			diffusion_rate2 = diffusion_rate_coeff2 * pow(np1, 2); // pi^2 * D2 * n^2 / a^2
-			
-			source_rate1 = source_rate_coeff_1 * n_coeff; // - 2 sqrt(2/pi) * S1 * (-1)^n/n
-			source_rate2 = source_rate_coeff_2 * n_coeff; // - 2 sqrt(2/pi) * S2 * (-1)^n/n
-
-			coeff_matrix[0] = 1.0 + (diffusion_rate1 + parameter.at(7) + parameter.at(8)) * increment;
-			coeff_matrix[1] = - parameter.at(6) * increment;
-			coeff_matrix[2] = - parameter.at(7) * increment;
-			coeff_matrix[3] = 1.0 + (diffusion_rate2 + parameter.at(6) + parameter.at(8)) * increment;
+			double projection_coeff = - 2.0 * sqrt(2.0 / pi);
+
+			const Real kernel_parameter[7] = {
+				pow(pi, 2) * parameter.at(1) / pow(parameter.at(3), 2), // pi^2 * D1 / a^2
+				pow(pi, 2) * parameter.at(2) / pow(parameter.at(3), 2), // pi^2 * D2 / a^2
+				projection_coeff * parameter.at(4), // - 2 sqrt(2/pi) * S1
+				projection_coeff * parameter.at(5), // - 2 sqrt(2/pi) * S2
+				parameter.at(6),
+				parameter.at(7),
+				parameter.at(8)
+			};
+
+			SpectralDiffusionKernel::Exponential2Equations(initial_condition_gas_1, initial_condition_gas_2, n_modes, kernel_parameter, increment);
+
+			gas_1 = SpectralDiffusionKernel::Projection(initial_condition_gas_1, n_modes);
+			gas_2 = SpectralDiffusionKernel::Projection(initial_condition_gas_2, n_modes);
+			return;
+		}
 
-			initial_conditions[0] = initial_condition_gas_1[n] + source_rate1 * increment;
-			initial_conditions[1] = initial_condition_gas_2[n] + source_rate2 * increment;
+		const Real resolution_rate = parameter.at(6);
+		const Real trapping_rate = parameter.at(7);
+		const Real decay_rate = parameter.at(8);
 
-			Solver::Laplace2x2(coeff_matrix, initial_conditions);
+		Real gas[2];
+		const Real diffusivity[2] = { parameter.at(1), parameter.at(2) };
+		const Real production[2] = { parameter.at(4), parameter.at(5) };
+		const Real rate_matrix[4] = {
+			trapping_rate + decay_rate, - resolution_rate,
+			- trapping_rate, resolution_rate + decay_rate
+		};
 
-			initial_condition_gas_1[n] = initial_conditions[0];
-			initial_condition_gas_2[n] = initial_conditions[1];
+		SpectralDiffusionNequations<2>(gas, modes, n_modes, diffusivity, parameter.at(3), production, rate_matrix, increment);
 
-			gas_1_solution += projection_coeff * n_coeff * initial_conditions[0] / ((4. / 3.) * pi);
-			gas_2_solution += projection_coeff * n_coeff * initial_conditions[1] / ((4. / 3.) * pi);
-		}
-		gas_1 = gas_1_solution;
-		gas_2 = gas_2_solution;
+		gas_1 = gas[0];
+		gas_2 = gas[1];
 	}
 
-	void SpectralDiffusion3equations(double& gas_1, double& gas_2, double& gas_3, double* initial_condition_gas_1, double* initial_condition_gas_2, double* initial_condition_gas_3, std::vector<double> parameter, double increment)
+	void SpectralDiffusion3equations(Real& gas_1, Real& gas_2, Real& gas_3, Real* initial_condition_gas_1, Real* initial_condition_gas_2, Real* initial_condition_gas_3, const std::vector<Real>& parameter, Real increment)
 	{
-		unsigned short int n(0);
-		unsigned short int np1(1);
+		/// Gas in solution (1), in intragranular bubbles (2) and in the HBS (3), swept from the non-restructured grains
 
-		double diffusion_rate1(0.0);
-		double diffusion_rate2(0.0);
-		double diffusion_rate3(0.0);
-
-		double diffusion_rate_coeff1(0.0);
-		double diffusion_rate_coeff2(0.0);
-		double diffusion_rate_coeff3(0.0);
-
-		double source_rate1(0.0);
-		double source_rate2(0.0);
-		double source_rate3(0.0);
-
-		double source_rate_coeff_1(0.0);
-		double source_rate_coeff_2(0.0);
-		double source_rate_coeff_3(0.0);
-
-		double projection_coeff(0.0);
-
-		double gas_1_solution(0.);
-		double gas_2_solution(0.);
-		double gas_3_solution(0.);
-
-		double coeff_matrix[9];
-		double initial_conditions[3];
+		// Parameters
+		// 0) N_modes
+		// 1-3) D1, D2, D3
+		// 4) r
+		// 5-7) production S1, S2, S3
+		// 8) resolution rate
+		// 9) trapping rate
+		// 10) decay rate
+		// 11) sweeping rate
+		// 12) time integrator (0 = backward Euler, 1 = exponential)
+		// 13) truncation tolerance of the modes (0 = all the modes)
+
+		TraceScope trace("Solver::SpectralDiffusion3equations", "solver");
 
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
-		diffusion_rate_coeff1 = pow(pi, 2) * parameter.at(1) / pow(parameter.at(4), 2); // pi^2 * D1 / a^2
-		diffusion_rate_coeff2 = pow(pi, 2) * parameter.at(2) / pow(parameter.at(4), 2); // pi^2 * D2 / a^2
-		diffusion_rate_coeff3 = pow(pi, 2) * parameter.at(3) / pow(parameter.at(4), 2); // pi^2 * D3 / a^2
-
-		projection_coeff = - 2.0 * sqrt(2.0 / pi);
+		// The modes of the three populations are truncated together, with the slower effective diffusivity (non-restructured or HBS)
+		Real* const modes[3] = { initial_condition_gas_1, initial_condition_gas_2, initial_condition_gas_3 };
+		const Real source_rate_coeff[3] = { - 2.0 * sqrt(2.0 / pi) * parameter.at(5), - 2.0 * sqrt(2.0 / pi) * parameter.at(6), - 2.0 * sqrt(2.0 / pi) * parameter.at(7) };
+		const int n_modes = ActiveDiffusionModes(modes, 3, Value(parameter.at(0)),
+			pow(pi, 2) * std::min(EffectiveDiffusivity(parameter.at(1), parameter.at(2), parameter.at(8), parameter.at(9)), parameter.at(3)) / pow(parameter.at(4), 2),
+			source_rate_coeff, increment, parameter.at(13));
 
-		source_rate_coeff_1 = projection_coeff * parameter.at(5); // - 2 sqrt(2/pi) * S1
-		source_rate_coeff_2 = projection_coeff * parameter.at(6); // - 2 sqrt(2/pi) * S2
-		source_rate_coeff_3 = projection_coeff * parameter.at(7); // - 2 sqrt(2/pi) * S3
-
-		for (n = 0; n < parameter.at(0); n++)
+		if (parameter.at(12) == 1.0)
 		{
-			np1 = n + 1;
-			const double n_coeff = pow(-1.0, np1) / np1;
-
-			diffusion_rate1 = diffusion_rate_coeff1 * pow(np1, 2); // pi^2 * D1 * n^2 / a^2
-			diffusion_rate2 = diffusion_rate_coeff2 * pow(np1, 2); // pi^2 * D2 * n^2 / a^2
-			diffusion_rate3 = diffusion_rate_coeff3 * pow(np1, 2); // pi^2 * D3 * n^2 / a^2			
-			
-			source_rate1 = source_rate_coeff_1 * n_coeff; // - 2 sqrt(2/pi) * S * (-1)^n/n
-			source_rate2 = source_rate_coeff_2 * n_coeff;
-			source_rate3 = source_rate_coeff_3 * n_coeff;
-
-			coeff_matrix[0] = 1.0 + (diffusion_rate1 + parameter.at(9) + parameter.at(10) + parameter.at(11)) * increment;
-			coeff_matrix[1] = - parameter.at(8) * increment;
-			coeff_matrix[2] = 0.0;
-
-			coeff_matrix[3] = - parameter.at(9) * increment;
-			coeff_matrix[4] = 1.0 + (diffusion_rate2 + parameter.at(8) + parameter.at(10) + parameter.at(11)) * increment;
-			coeff_matrix[5] = 0.0;
-		
-			coeff_matrix[6] = - parameter.at(11) * increment;
-			coeff_matrix[7] = - parameter.at(11) * increment;
-			coeff_matrix[8] = 1.0 + (diffusion_rate3 + parameter.at(10)) * increment;
-			
-			initial_conditions[0] = initial_condition_gas_1[n] + source_rate1 * increment;
-			initial_conditions[1] = initial_condition_gas_2[n] + source_rate2 * increment;
-			initial_conditions[2] = initial_condition_gas_3[n] + source_rate3 * increment;
-
-			Solver::Laplace3x3(coeff_matrix, initial_conditions);
-
-			initial_condition_gas_1[n] = initial_conditions[0];
-			initial_condition_gas_2[n] = initial_conditions[1];
-			initial_condition_gas_3[n] = initial_conditions[2];
-
-			gas_1_solution += projection_coeff * n_coeff * initial_conditions[0] / ((4. / 3.) * pi);
-			gas_2_solution += projection_coeff * n_coeff * initial_conditions[1] / ((4. / 3.) * pi);
-			gas_3_solution += projection_coeff * n_coeff * initial_conditions[2] / ((4. / 3.) * pi);
+			double projection_coeff = - 2.0 * sqrt(2.0 / pi);
+
+			const Real kernel_parameter[10] = {
+				pow(pi, 2) * parameter.at(1) / pow(parameter.at(4), 2), // pi^2 * D1 / a^2
+				pow(pi, 2) * parameter.at(2) / pow(parameter.at(4), 2), // pi^2 * D2 / a^2
+				pow(pi, 2) * parameter.at(3) / pow(parameter.at(4), 2), // pi^2 * D3 / a^2
+				projection_coeff * parameter.at(5), // - 2 sqrt(2/pi) * S1
+				projection_coeff * parameter.at(6), // - 2 sqrt(2/pi) * S2
+				projection_coeff * parameter.at(7), // - 2 sqrt(2/pi) * S3
+				parameter.at(8),
+				parameter.at(9),
+				parameter.at(10),
+				parameter.at(11)
+			};
+
+			SpectralDiffusionKernel::Exponential3Equations(initial_condition_gas_1, initial_condition_gas_2, initial_condition_gas_3, n_modes, kernel_parameter, increment);
+
+			gas_1 = SpectralDiffusionKernel::Projection(initial_condition_gas_1, n_modes);
+			gas_2 = SpectralDiffusionKernel::Projection(initial_condition_gas_2, n_modes);
+			gas_3 = SpectralDiffusionKernel::Projection(initial_condition_gas_3, n_modes);
+			return;
 		}
-		gas_1 = gas_1_solution;
-		gas_2 = gas_2_solution;
-		gas_3 = gas_3_solution;
+
+		const Real resolution_rate = parameter.at(8);
+		const Real trapping_rate = parameter.at(9);
+		const Real decay_rate = parameter.at(10);
+		const Real sweeping_rate = parameter.at(11);
+
+		Real gas[3];
+		const Real diffusivity[3] = { parameter.at(1), parameter.at(2), parameter.at(3) };
+		const Real production[3] = { parameter.at(5), parameter.at(6), parameter.at(7) };
+		const Real rate_matrix[9] = {
+			trapping_rate + decay_rate + sweeping_rate, - resolution_rate, 0.0,
+			- trapping_rate, resolution_rate + decay_rate + sweeping_rate, 0.0,
+			- sweeping_rate, - sweeping_rate, decay_rate
+		};
+
+		SpectralDiffusionNequations<3>(gas, modes, n_modes, diffusivity, parameter.at(4), production, rate_matrix, increment);
+
+		gas_1 = gas[0];
+		gas_2 = gas[1];
+		gas_3 = gas[2];
 	}
 
 	/// The function solve a system of two linear equations according to Cramer method.
-	void Laplace2x2(double A[], double b[])
+	void Laplace2x2(Real A[], Real b[])
 	{
-		double detX(0.0), detY(0.0);
-		double detA = A[0] * A[3] - A[1] * A[2];
+		Real detX(0.0), detY(0.0);
+		Real detA = A[0] * A[3] - A[1] * A[2];
 
 		if (detA != 0.0)
 		{
@@ -302,10 +357,10 @@ public:
 	}
 
 	//The function solve a system of three linear equations according to Cramer method.
-	void Laplace3x3(double A[], double b[])
+	void Laplace3x3(Real A[], Real b[])
 	{
-		double detX(0.0), detY(0.0), detZ(0.0);
-		double detA = A[0]*(A[4]*A[8]-A[5]*A[7]) - A[1]*(A[3]*A[8]-A[5]*A[6]) + A[2]*(A[3]*A[7]-A[4]*A[6]);
+		Real detX(0.0), detY(0.0), detZ(0.0);
+		Real detA = A[0]*(A[4]*A[8]-A[5]*A[7]) - A[1]*(A[3]*A[8]-A[5]*A[6]) + A[2]*(A[3]*A[7]-A[4]*A[6]);
 
 		if (detA != 0.0)
 		{
@@ -318,60 +373,78 @@ public:
 		}
 	}
 
-	//The function compute the determinant of a NxN matrix according to Cramer method
-	double det(int N, double A[])
+	/// LU factorization with partial pivoting of the NxN matrix A (row-major, in place): returns the sign of the row
+	/// permutation, or 0 if A is singular. The rows are swapped in A and in b (if given) as in the factorization.
+	int LUDecomposition(int N, Real A[], Real b[])
 	{
-		int dim = N*N;
-		// int Nm1 = N-1;
-		double C[(N-1)*(N-1)];
-		double sum = 0.0;
+		int sign(1);
+		for (int k = 0; k < N; ++k)
+		{
+			int pivot = k;
+			for (int i = k + 1; i < N; ++i)
+				if (fabs(A[i * N + k]) > fabs(A[pivot * N + k]))
+					pivot = i;
 
-		if (N == 2) {
-			return A[0]*A[3] - A[1]*A[2];
-		}
-		else {
-			for (int i=0; i < N; i++) {
-			int j = 0;
-			for (int z = N; z < dim; z++) {
-				if ((dim-z+i) % N != 0) {
-				C[j] = A[z];
-				j++;
-				}
+			if (A[pivot * N + k] == 0.0)
+				return 0;
+
+			if (pivot != k)
+			{
+				for (int j = 0; j < N; ++j)
+					std::swap(A[k * N + j], A[pivot * N + j]);
+				if (b)
+					std::swap(b[k], b[pivot]);
+				sign = - sign;
 			}
-				int r = i/N;
-				int c = i%N;
-				sum += ((r+c)%2==0 ? +1:-1)*A[i]*det(N-1, C);
+
+			for (int i = k + 1; i < N; ++i)
+			{
+				A[i * N + k] /= A[k * N + k];
+				for (int j = k + 1; j < N; ++j)
+					A[i * N + j] -= A[i * N + k] * A[k * N + j];
 			}
-			return sum;
 		}
+		return sign;
 	}
 
-	void Laplace(int N, double A[], double b[])
+	/// The function computes the determinant of a NxN matrix, as the product of the pivots of its LU factorization
+	Real det(int N, Real A[])
 	{
-		int dim = N*N;
-		double detA = det(N, A);
-		double M[dim];
-		double detX = 0.0;
-		double x[N];
-
-		for (int i = 0; i < N; i++) {
-			for (int j = 0; j < dim; j++) {
-			if (j%N == i) {
-				M[j] = b[j/N];
-			}
-			else {
-				M[j] = A[j];
-			}
-			}
-			detX = det(N, M);
-			x[i] = detX/detA;
-		}
-		for (int i = 0; i < N; i++) {
-			b[i] = x[i];
+		std::vector<Real> LU(A, A + N * N);
+
+		int sign = LUDecomposition(N, LU.data(), nullptr);
+		Real determinant(sign);
+		for (int k = 0; k < N && sign != 0; ++k)
+			determinant *= LU[k * N + k];
+
+		return determinant;
+	}
+
+	/// The function solves a system of N linear equations (A x = b, the solution is stored in b) by Gaussian elimination
+	/// with partial pivoting. As Laplace2x2 and Laplace3x3, b is left unchanged if A is singular.
+	void Laplace(int N, Real A[], Real b[])
+	{
+		std::vector<Real> LU(A, A + N * N);
+		std::vector<Real> x(b, b + N);
+
+		if (LUDecomposition(N, LU.data(), x.data()) == 0)
+			return;
+
+		for (int i = 0; i < N; ++i)
+			for (int j = 0; j < i; ++j)
+				x[i] -= LU[i * N + j] * x[j];
+
+		for (int i = N - 1; i >= 0; --i)
+		{
+			for (int j = i + 1; j < N; ++j)
+				x[i] -= LU[i * N + j] * x[j];
+			x[i] /= LU[i * N + i];
 		}
+
+		std::copy(x.begin(), x.end(), b);
 	}
 
-	double QuarticEquation(std::vector<double> parameter)
+	Real QuarticEquation(std::vector<Real> parameter, NewtonWarmStart<Real>* warm_start = nullptr)
 	{
 		/**
 		 * @brief Solver for the quartic equation ax^4 + bx^3 +cx^2 +dx + e = 0
@@ -383,46 +456,49 @@ public:
 		 * @param parameter.at(3) coefficient of x^2
 		 * @param parameter.at(4) coefficient of x^1
 		 * @param parameter.at(5) coefficient of x^0
+		 * @param warm_start if not null, the first guess is its last converged root (iNewtonWarmStart = 1), updated with the solution
 		 * @return x1 solution
 		 */
 
-		double function(0.0);
-		double derivative(0.0);
-		double y1(0.0);
-		unsigned short int iter(0);
-		const double tol(1.0e-3);
-		const unsigned short int max_iter(5);
-
-		double y0 = parameter.at(0);
-		double a = parameter.at(1);
-		double b = parameter.at(2);
-		double c = parameter.at(3);
-		double d = parameter.at(4);
-		double e = parameter.at(5);
-
-		while (iter < max_iter)
-		{
-			function = a*pow(y0, 4) + b*pow(y0, 3) + c*pow(y0, 2) + d*y0 + e;
-			derivative = 4.0*a*pow(y0, 3) + 3.0*b*pow(y0, 2) + 2.0*c*y0 + d;
-
-			y1 = y0 - function/derivative;
-			y0 = y1;
-
-			if(function < tol) return y1;
+		TraceScope trace("Solver::QuarticEquation", "solver");
 
-			iter++;
-		}
-		return y1;
+		const double tol(1.0e-3);
+		const int max_iter(5);
+
+		Real y0 = parameter.at(0);
+		if (warm_start)
+			y0 = warm_start->guess(y0);
+
+		Real a = parameter.at(1);
+		Real b = parameter.at(2);
+		Real c = parameter.at(3);
+		Real d = parameter.at(4);
+		Real e = parameter.at(5);
+
+		NewtonResult<Real> result = Newton(y0,
+			[&](const Real& y) { return a*pow(y, 4) + b*pow(y, 3) + c*pow(y, 2) + d*y + e; },
+			[&](const Real& y) { return 4.0*a*pow(y, 3) + 3.0*b*pow(y, 2) + 2.0*c*y + d; },
+			// the signed residual is tested: the iterations stop once the quartic is below the tolerance
+			[&](const Real& function) { return function < tol; },
+			NewtonSettings(max_iter));
+
+		if (warm_start)
+			warm_start->update(result);
+
+		TraceNewton(trace, result);
+		return result.root;
 	}
 
-	void modeInitialization(int n_modes, double mode_initial_condition, double* diffusion_modes)
+	void modeInitialization(int n_modes, Real mode_initial_condition, Real* diffusion_modes)
 	{
+		TraceScope trace("Solver::modeInitialization", "solver");
+
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
 		// projection on diffusion modes of the initial conditions
-		double initial_condition(0.0);
-		double projection_remainder(0.0);
-		double reconstructed_solution(0.0);
+		Real initial_condition(0.0);
+		Real projection_remainder(0.0);
+		Real reconstructed_solution(0.0);
 		int iteration(0), iteration_max(20), n(0), np1(1);
 		double projection_coeff(0.0);
 		projection_coeff = -sqrt(8.0 / pi);
@@ -444,24 +520,23 @@ public:
 		}
 	}
 
-	double NewtonBlackburn(std::vector<double> parameter)
+	Real NewtonBlackburn(std::vector<Real> parameter, NewtonWarmStart<Real>* warm_start = nullptr)
 	{
 		/**
 		 * @brief Solver for the non-linear equation (Blackburn's thermochemical urania model) log(PO2(x)) = 2.0*log(x*(x+2.0)/(1.0-x)) + 108.0*pow(x,2.0) - 32700.0/T + 9.92
 		 * with the iterative Newton's method.
+		 * With a warm start (iNewtonWarmStart = 1), the first guess is its last converged root, updated with the solution.
 		 * 
 		 */
 
-		double fun(0.0);
-		double deriv(0.0);
-		double x1(0.0);
-		unsigned short int iter(0);
+		TraceScope trace("Solver::NewtonBlackburn", "solver");
+
 		const double tol(1.0e-3);
-		const unsigned short int max_iter(50);
+		const int max_iter(50);
 		
-		double a = parameter.at(0);
-		double b = parameter.at(1);
-		double c = log(parameter.at(2));
+		Real a = parameter.at(0);
+		Real b = parameter.at(1);
+		Real c = log(parameter.at(2));
 
 		if(parameter.at(2)==0)
 			std::cout << "Warning: check NewtonBlackburn solver!" << std::endl;
@@ -469,56 +544,51 @@ public:
 		if(a == 0.0)
 			a = 1.0e-7;
 
-		while (iter < max_iter)
-		{
-			fun =  2.0*log(a*(a+2.0)/(1.0-a)) + 108.0*pow(a,2.0) - 32700.0/b + 9.92 - c;
+		if (warm_start)
+			a = warm_start->guess(a);
 
-			deriv = 216.0*a + 2.0*(pow(a,2.0)-2.0*a-2.0)/((a-1.0)*a*(2.0+a));
+		NewtonResult<Real> result = Newton(a,
+			[&](const Real& x) { return 2.0*log(x*(x+2.0)/(1.0-x)) + 108.0*pow(x,2.0) - 32700.0/b + 9.92 - c; },
+			[&](const Real& x) { return 216.0*x + 2.0*(pow(x,2.0)-2.0*x-2.0)/((x-1.0)*x*(2.0+x)); },
+			IntegerResidual(tol),
+			NewtonSettings(max_iter));
 
-			x1 = a - fun/deriv;
-			a = x1;
+		if (warm_start)
+			warm_start->update(result);
 
-			if(abs(fun)<tol) return x1;
-
-			iter++;
-		}
-		return x1;
+		TraceNewton(trace, result);
+		return result.root;
 	}
 
-	double NewtonLangmuirBasedModel(double initial_value, std::vector<double> parameter, double increment)
+	Real NewtonLangmuirBasedModel(Real initial_value, std::vector<Real> parameter, Real increment, NewtonWarmStart<Real>* warm_start = nullptr)
 	{
 		/// Solver for the ODE [y' = K(1-beta*exp(alpha*y)))]
 		/// @param parameter[0] = K
 		/// @param parameter[1] = beta
 		/// @param parameter[2] = alpha
+		/// With a warm start (iNewtonWarmStart = 1), the first guess is its last converged root instead of the initial value
 
-		double K = parameter.at(0);
-		double beta = parameter.at(1);
-		double alpha = parameter.at(2);
-		double x0 = initial_value;
-		double x00 = initial_value;
+		TraceScope trace("Solver::NewtonLangmuirBasedModel", "solver");
 
-		double fun(0.0);
-		double deriv(0.0);
-		double x1(0.0);
-		unsigned short int iter(0);
-		const double tol(1.0e-3);
-		const unsigned short int max_iter(50);
-
-		while (iter < max_iter)
-		{
-		fun = x0 - x00 - K * increment + K * beta * exp(alpha * x0) * increment;
+		Real K = parameter.at(0);
+		Real beta = parameter.at(1);
+		Real alpha = parameter.at(2);
+		Real x00 = initial_value;
 
-		deriv = 1.0 + K * beta * alpha * exp(alpha * x0) * increment;
+		const double tol(1.0e-3);
+		const int max_iter(50);
 
-		x1 = x0 - fun/deriv;
-		x0 = x1;
+		NewtonResult<Real> result = Newton(warm_start ? warm_start->guess(initial_value) : initial_value,
+			[&](const Real& x) { return x - x00 - K * increment + K * beta * exp(alpha * x) * increment; },
+			[&](const Real& x) { return 1.0 + K * beta * alpha * exp(alpha * x) * increment; },
+			IntegerResidual(tol),
+			NewtonSettings(max_iter));
 
-		if(abs(fun)<tol) return x1;
+		if (warm_start)
+			warm_start->update(result);
 
-		iter++;
-		}
-		return x1;
+		TraceNewton(trace, result);
+		return result.root;
 	}
 
 
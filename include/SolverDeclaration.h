@@ -20,6 +20,6 @@
 #include <vector>
 #include "Solver.h"
 
-extern Solver solver;
+extern thread_local Solver solver;
 
 #endif // SOLVER_DECLARATION_H
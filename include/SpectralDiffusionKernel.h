@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPECTRAL_DIFFUSION_KERNEL_H
+#define SPECTRAL_DIFFUSION_KERNEL_H
+
+#include <vector>
+#include "Real.h"
+
+/// SpectralModeTable
+/// Coefficients of the spectral modes that do not depend on the time step (see Solver::SpectralDiffusion):
+/// n_coeff = (-1)^n / n, n_squared = n^2, projection = projection_coeff * n_coeff, for n = 1, ..., size,
+/// equilibrium_projection = |projection * n_coeff| / n^2 (projection of the equilibrium mode of a unit source, unit diffusion rate).
+
+class SpectralModeTable
+{
+public:
+	std::vector<double> n_coeff;
+	std::vector<double> n_squared;
+	std::vector<double> projection;
+	std::vector<double> equilibrium_projection;
+
+	int size() const
+	{
+		return int(n_coeff.size());
+	}
+
+	/// Table with (at least) n_modes modes, built once per thread
+	static const SpectralModeTable& get(int n_modes);
+
+	SpectralModeTable(int n_modes);
+	~SpectralModeTable() { }
+};
+
+/// SpectralDiffusionKernel
+/// Per-mode updates of the spectral diffusion solvers, vectorized over the modes (AVX2 / AVX-512 where available,
+/// selected at runtime; scalar otherwise). Every mode is computed with the same floating-point operations as the scalar
+/// solver, and the projections are summed in the order of the modes: the results do not depend on the instruction set.
+
+namespace SpectralDiffusionKernel
+{
+	/// Backward Euler update of the modes of [dy/dt = D div grad y + S - L y]:
+	/// y_n = (y_n + S_n dt) / (1 + L_n dt), with L_n = diffusion_rate_coeff * n^2 + loss_rate, S_n = source_rate_coeff * n_coeff
+	void Decay(double* modes, int n_modes, double diffusion_rate_coeff, double loss_rate, double source_rate_coeff, double increment);
+
+	/// Largest number of coupled equations of DecayNEquations
+	const int max_coupled_equations = 8;
+
+	/// Backward Euler update of the modes of N coupled equations [dy_i/dt = D_i div grad y_i + S_i - sum_j K_ij y_j]
+	/// (e.g., gas in solution, in bubbles, in the HBS, in traps), N = 2 ... max_coupled_equations:
+	/// (I + (diag(D_i n^2) + K) dt) y_n = y_n + S_i n_coeff dt, solved for each mode by Gaussian elimination (Cramer's rule for N = 2).
+	/// rate_matrix: K, row-major, with the loss rates of each equation on the diagonal and minus the rates of transfer
+	/// from the equation j to the equation i off it. Each loss rate is at least the sum of the transfers out of its equation
+	/// (K column diagonally dominant), which makes the elimination stable without pivoting.
+	template <int N>
+	void DecayNEquations(double* const modes[N], int n_modes, const double diffusion_rate_coeff[N], const double source_rate_coeff[N], const double rate_matrix[N * N], double increment);
+
+	/// Spatial average of the solution, sum over the modes of projection * y_n / (4/3 pi)
+	double Projection(const double* modes, int n_modes);
+
+	/// Nodes advanced together by DecayNodes and ProjectionNodes, vectorized over the nodes instead of the modes (batches of nodes,
+	/// see SciantixBatch): the modes of the block are stored by mode, modes[n * batch_nodes + k] being the mode n of the node k
+	const int batch_nodes = 8;
+
+	/// Decay of the modes of batch_nodes nodes, with the coefficients of each node: every node goes through the operations of Decay
+	void DecayNodes(double* modes, int n_modes, const double diffusion_rate_coeff[], const double loss_rate[], const double source_rate_coeff[], const double increment[]);
+
+	/// Projection of the modes of batch_nodes nodes (projection[k] of the node k), summed in the order of the modes as Projection
+	void ProjectionNodes(const double* modes, int n_modes, double projection[]);
+
+	/// Adaptive truncation of the modes (iAdaptiveModes): number of leading modes to advance, out of n_modes.
+	/// The contribution of a mode to the projection is bounded by its amplitudes in the n_arrays coupled arrays, plus its
+	/// equilibrium amplitude under the sources, S_n / (D n^2), with the (effective) diffusion rate coefficient of the arrays
+	/// (losses neglected). The highest modes are truncated (set to zero) while the sum of their contributions stays below
+	/// tolerance times the gas in the first mode (with the gas produced over the increment); they are advanced again as soon as
+	/// their amplitudes or the sources make them count. No truncation with D = 0.
+	int ActiveModes(double* const modes[], int n_arrays, int n_modes, double diffusion_rate_coeff, const double source_rate_coeff[], double increment, double tolerance);
+
+	/// Instruction set of the kernels: "avx512", "avx2" or "scalar"
+	const char* InstructionSet();
+
+	/// Exponential integrators: exact solution over the increment of the same mode equations, with rates and sources
+	/// constant over the time step (iDiffusionIntegrator = 1). Same parameters of Decay, and for the coupled equations
+	/// 0) D1 coeff 1) D2 coeff 2) S1 coeff 3) S2 coeff 4) resolution rate 5) trapping rate 6) decay rate
+	/// 0-2) D1-D3 coeff 3-5) S1-S3 coeff 6) resolution rate 7) trapping rate 8) decay rate 9) sweeping rate
+	void ExponentialDecay(double* modes, int n_modes, double diffusion_rate_coeff, double loss_rate, double source_rate_coeff, double increment);
+	void Exponential2Equations(double* modes_1, double* modes_2, int n_modes, const double parameter[7], double increment);
+	void Exponential3Equations(double* modes_1, double* modes_2, double* modes_3, int n_modes, const double parameter[10], double increment);
+
+#ifdef SCIANTIX_TANGENT_DIRECTIONS
+	/// The same updates on Dual numbers (see Real.h), mode by mode, for the derivatives of the spectral solvers
+	void Decay(Real* modes, int n_modes, Real diffusion_rate_coeff, Real loss_rate, Real source_rate_coeff, Real increment);
+	template <int N>
+	void DecayNEquations(Real* const modes[N], int n_modes, const Real diffusion_rate_coeff[N], const Real source_rate_coeff[N], const Real rate_matrix[N * N], Real increment);
+	Real Projection(const Real* modes, int n_modes);
+	int ActiveModes(Real* const modes[], int n_arrays, int n_modes, Real diffusion_rate_coeff, const Real source_rate_coeff[], Real increment, double tolerance);
+	void ExponentialDecay(Real* modes, int n_modes, Real diffusion_rate_coeff, Real loss_rate, Real source_rate_coeff, Real increment);
+	void Exponential2Equations(Real* modes_1, Real* modes_2, int n_modes, const Real parameter[7], Real increment);
+	void Exponential3Equations(Real* modes_1, Real* modes_2, Real* modes_3, int n_modes, const Real parameter[10], Real increment);
+#endif
+}
+
+#endif // SPECTRAL_DIFFUSION_KERNEL_H
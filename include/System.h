@@ -30,22 +30,47 @@
 
 class System : virtual public Gas, virtual public Matrix
 {
+public:
+	/// Handles of the objects depending on the system (e.g., "Xe in grain" for Xe in UO2), resolved once by resolveHandles()
+	enum Handle
+	{
+		produced,
+		produced_in_hbs,
+		decayed,
+		in_grain,
+		in_grain_hbs,
+		in_intragranular_solution,
+		in_intragranular_bubbles,
+		at_grain_boundary,
+		released,
+		intragranular_atoms_per_bubble,
+		intergranular_atoms_per_bubble,
+		gas_production_model,
+		gas_diffusion_model,
+		gas_index,
+		matrix_index,
+		diffusion_modes_section,
+		n_handles
+	};
+
 protected:
-	double yield;
-	double radius_in_lattice;
-	double volume_in_lattice;
-	double diffusivity;
-	double bubble_diffusivity;
-	double henry_constant;
-	double resolution_rate;
-	double trapping_rate;
-	double nucleation_rate;
+	Real yield;
+	Real radius_in_lattice;
+	Real volume_in_lattice;
+	Real diffusivity;
+	Real bubble_diffusivity;
+	Real henry_constant;
+	Real resolution_rate;
+	Real trapping_rate;
+	Real nucleation_rate;
 	std::string gas_name;
 	std::string matrix_name;
-	double pore_nucleation_rate;
-	std::vector<double> modes;
-	double production_rate;
+	Real pore_nucleation_rate;
+	std::vector<Real> modes;
+	Real production_rate;
 	bool restructured_matrix;
+	int handle[n_handles];
+	bool handles_resolved = false;
 
 public:
 	void setRestructuredMatrix(bool y)
@@ -58,25 +83,25 @@ public:
 		return restructured_matrix;
 	}
 
-	void setYield(double y)
+	void setYield(Real y)
 	{
 		/// Member function to set the (cumulative) yield of the fission gas (at/fiss).
 		yield = y;
 	}
 
-	double getYield()
+	Real getYield()
 	{
 		/// Member function to get the (cumulative) yield of the fission gas (at/fiss).
 		return yield;
 	}
 
-	void setRadiusInLattice(double r)
+	void setRadiusInLattice(Real r)
 	{
 		/// Member function to set the radius of the fission gas atom in the matrix lattice (m).
 		radius_in_lattice = r;
 	}
 
-	double getRadiusInLattice()
+	Real getRadiusInLattice()
 	{
 		/// Member function to get the radius of the fission gas atom in the matrix lattice (m).
 		return radius_in_lattice;
@@ -106,85 +131,85 @@ public:
 		return matrix_name;
 	}
 
-	double getVolumeInLattice()
+	Real getVolumeInLattice()
 	{
 		/// Member function to get the volume occupied by the gas in matrix
 		return volume_in_lattice;
 	}
 
-	void setVolumeInLattice(double v)
+	void setVolumeInLattice(Real v)
 	{
 		/// Member function to set the volume occupied by the gas in matrix
 		volume_in_lattice = v;
 	}
 	
 	void setBubbleDiffusivity(int input_value);
-	double getBubbleDiffusivity()
+	Real getBubbleDiffusivity()
 	{
 		/// Member function to get the bubble diffusivity of the isotope in the fuel matrix
 		return bubble_diffusivity;	
 	}
 
 	void setHeliumDiffusivity(int input_value);
-	double getHeliumDiffusivity()
+	Real getHeliumDiffusivity()
 	{
 		/// Member function to get the bubble diffusivity of the isotope in the fuel matrix
 		return diffusivity;	
 	}
 
 	void setFissionGasDiffusivity(int input_value);	
-	double getFissionGasDiffusivity()
+	Real getFissionGasDiffusivity()
 	{
 		/// Member function to get the diffusivity of the isotope in the fuel matrix
 		return diffusivity;
 	}
 
-	void setHenryConstant(double h)
+	void setHenryConstant(Real h)
 	{
 		/// Member function to set the value of the Henry constant
 		henry_constant = h;
 	}
 
-	double getHenryConstant()
+	Real getHenryConstant()
 	{
 		/// Member function to get the value of the Henry constant
 		return henry_constant;
 	}
 
 	void setResolutionRate(int input_value);
-	double getResolutionRate()
+	Real getResolutionRate()
 	{
 		/// Member function to get the value of the resolution rate of the isotope from fuel matrix nanobubbles
 		return resolution_rate;
 	}
 
 	void setTrappingRate(int input_value);
-	double getTrappingRate()
+	Real getTrappingRate()
 	{
 		/// Member function to get the value of the trapping rate of the isotope in the fuel matrix nanobubbles
 		return trapping_rate;
 	}
 
 	void setNucleationRate(int input_value);
-	double getNucleationRate()
+	Real getNucleationRate()
 	{
 		return nucleation_rate;
 	}
 
-	void setPoreNucleationRate(double t)
+	void setPoreNucleationRate(Real t)
 	{
 		pore_nucleation_rate = t;
 	}
 
-	double getPoreNucleationRate()
+	Real getPoreNucleationRate()
 	{
 		return pore_nucleation_rate;
 	}
 
 	void setProductionRate(int input_value);
-	double getProductionRate()
+	Real getProductionRate()
 	{
-    /** @fn double getProductionRate()
+    /** @fn Real getProductionRate()
      * @brief Member function to get the production rate of the sciantix_system.
 		 *  
      * @param production_rate: output
@@ -192,6 +217,19 @@ public:
 		return production_rate;
 	}
 
+	void resolveHandles();
+
+	int getHandle(Handle h)
+	{
+		/// Member function to get the handle (index in sciantix_variable, model, gas, matrix, modes_initial_conditions) of a system-dependent object
+		return handle[h];
+	}
+
+	void setHandle(Handle h, int value)
+	{
+		handle[h] = value;
+	}
+
 	System() { }
 	~System() { }
 };
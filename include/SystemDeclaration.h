@@ -19,8 +19,9 @@
 
 #include <vector>
 #include "ConstantNumbers.h"
+#include "Registry.h"
 #include "System.h"
 
-extern std::vector<System> sciantix_system;
+extern thread_local Registry<System> sciantix_system;
 
 #endif
@@ -14,5 +14,6 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 #include "MainVariables.h"
+#include "HistoryCursor.h"
 
-double TimeStepCalculation();
+double TimeStepCalculation(const HistoryCursor& history);
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <chrono>
+#include <limits>
+#include <ostream>
+
+/// Event tracing (iTrace = 1)
+/// Records the begin and the duration of the stages of the time step, of the solver calls and of the steps of the
+/// time loop, tagged with the time step number and the node (SciantixContext::node_id). Each thread records in its
+/// own buffer, without locks: tracing does not serialize the nodes advanced on different threads.
+/// The events are written at the end of the simulation as Chrome trace JSON (trace.json), to be opened with
+/// Perfetto (ui.perfetto.dev) or chrome://tracing. With tracing disabled, each event costs a single branch.
+
+/// Enables or disables the tracing on this thread
+void SetTracing(bool enabled);
+bool IsTracing();
+
+/// Time step number and node of the next events of this thread
+void SetTraceTags(long long time_step_number, int node_id);
+
+/// Records a complete event (category: "stage", "solver", "loop"); iterations < 0 and residual NaN if not relevant
+void TraceEvent(const char* name, const char* category, std::chrono::steady_clock::time_point begin,
+	std::chrono::steady_clock::time_point end, int iterations = -1, double residual = std::numeric_limits<double>::quiet_NaN());
+
+/// TraceScope
+/// Event from the construction to the destruction of the scope
+class TraceScope
+{
+protected:
+	const char* name;
+	const char* category;
+	bool enabled;
+	int iterations;
+	double residual;
+	std::chrono::steady_clock::time_point begin;
+
+public:
+	/// Number of iterations of the solver, reported in the event
+	void setIterations(int n)
+	{
+		iterations = n;
+	}
+
+	/// Residual of the last iteration of the solver, reported in the event
+	void setResidual(double r)
+	{
+		residual = r;
+	}
+
+	TraceScope(const char* name, const char* category) :
+		name(name), category(category), enabled(IsTracing()), iterations(-1), residual(std::numeric_limits<double>::quiet_NaN())
+	{
+		if (enabled)
+			begin = std::chrono::steady_clock::now();
+	}
+
+	~TraceScope()
+	{
+		if (enabled)
+			TraceEvent(name, category, begin, std::chrono::steady_clock::now(), iterations, residual);
+	}
+
+	TraceScope(const TraceScope&) = delete;
+	TraceScope& operator=(const TraceScope&) = delete;
+};
+
+/// Writes the events of all the threads as Chrome trace JSON (when no thread is recording)
+void WriteTraceJSON(std::ostream& stream);
+
+/// Removes the events of all the threads
+void ClearTrace();
+
+#endif // TRACING_H
@@ -15,6 +15,7 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "MatrixDeclaration.h"
+#include "MapMatrix.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
 #include "HistoryVariableDeclaration.h"
@@ -17,9 +17,10 @@
 #include "SciantixVariableDeclaration.h"
 #include "HistoryVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "MapModel.h"
 #include "MapSciantixVariable.h"
 #include "MapHistoryVariable.h"
 
 void UO2Thermochemistry();
 
-double BlackburnThermochemicalModel(double stoichiometry_deviation, double temperature);
+Real BlackburnThermochemicalModel(Real stoichiometry_deviation, Real temperature);
@@ -21,4 +21,4 @@
 #include <vector>
 #include <map>
 
-void UpdateVariables(double Sciantix_variables[], double Sciantix_diffusion_modes[]);
+void UpdateVariables(Real Sciantix_variables[], Real Sciantix_diffusion_modes[]);
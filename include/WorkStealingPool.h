@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// WorkStealingPool
+/// Pool of worker threads running a set of independent tasks (e.g., the cases of a batch, see BatchRun.h).
+/// The tasks are dealt to the queues of the workers in round robin. Each worker runs the tasks of its own queue, from the front,
+/// and when it is empty steals from the back of the queues of the other workers: the workers that received the short tasks
+/// take over the tasks still queued behind the long ones, and the run lasts about the total work divided by the number of workers.
+
+class WorkStealingPool
+{
+protected:
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<int> tasks;
+	};
+
+	int n_threads;
+	std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+	/// Next task of the queue of the worker
+	bool pop(int worker, int& task);
+
+	/// Last task of the queue of another worker
+	bool steal(int worker, int& task);
+
+public:
+	/// Number of worker threads, std::thread::hardware_concurrency() if n_threads <= 0
+	explicit WorkStealingPool(int n_threads);
+
+	int size() const
+	{
+		return n_threads;
+	}
+
+	/// Runs task(i, worker) for i = 0, ..., n_tasks - 1 and returns when all the tasks are done.
+	/// The tasks must not throw (the exceptions of a task are handled by the task itself).
+	void run(int n_tasks, const std::function<void(int, int)>& task);
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -18,6 +18,7 @@
 #define XE_IN_UO2_H
 
 #include "SystemDeclaration.h"
+#include "MapSystem.h"
 #include "MatrixDeclaration.h"
 #include "MapMatrix.h"
 #include "SciantixScalingFactorDeclaration.h"
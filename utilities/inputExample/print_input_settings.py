@@ -12,7 +12,7 @@ with open('input_settings.txt', 'w') as file:
     file.write('1\t#\tiResolutionRate (0= constant value, 1= Turnbull (1971), 2= Losonen (2000), 3= thermal resolution, Cognini et al. (2021))\n')
     file.write('1\t#\tiTrappingRate (0= constant value, 1= Ham (1958))\n')
     file.write('1\t#\tiNucleationRate (0= constant value, 1= Olander, Wongsawaeng (2006))\n')
-    file.write('1\t#\tiOutput (1= default output files)\n')
+    file.write('1\t#\tiOutput (1= default output files, 2= all the variables, 3= binary columnar output.bin)\n')
     file.write('1\t#\tiGrainBoundaryVacancyDiffusivity (0= constant value, 1= Reynolds and Burton (1979), 2= White (2004) \n')
     file.write('1\t#\tiGrainBoundaryBehaviour (0= no grain boundary bubbles, 1= Pastore et al (2013))\n')
     file.write('1\t#\tiGrainBoundaryMicroCracking (0= no model considered, 1= Barani et al. (2017))\n')
@@ -26,4 +26,16 @@ with open('input_settings.txt', 'w') as file:
     file.write('0\t#\tiHighBurnupStructurePorosity (0= no evolution of HBS porosity, 1= HBS porosity evolution based on Spino et al. (2006) data)\n')
     file.write('0\t#\tiHeliumProductionRate (0= zero production rate, 1= helium from ternary fissions, 2= linear with burnup (FR))\n')
     file.write('0\t#\tiStoichiometryDeviation (0= not considered, 1= Cox et al. 1986, 2= Bittel et al. 1969, 3= Abrefah et al. 1994, 4= Imamura et al. 1997, 5= Langmuir-based approach)\n')
-    file.write('0\t#\tiBubbleDiffusivity (0= not considered, 1= volume diffusivity)')
+    file.write('0\t#\tiBubbleDiffusivity (0= not considered, 1= volume diffusivity)\n')
+    file.write('0\t#\tiDiffusionIntegrator (0= backward Euler, 1= exponential integrator)\n')
+    file.write('0\t#\tiAdaptiveTimeStep (0= fixed number of time steps per interval, k= adaptive time step with relative tolerance 10^-k)\n')
+    file.write('0\t#\tiAsyncOutput (0= output written by the time loop, 1= output written by a background thread)\n')
+    file.write('0\t#\tiOutputStride (0= output at every time step, N= output every N time steps)\n')
+    file.write('0\t#\tiOutputAtHistoryPoints (0= not considered, 1= output at the points of the input history)\n')
+    file.write('0\t#\tiOutputChangeThreshold (0= not considered, k= output when a variable changes by more than 10^-k)\n')
+    file.write('0\t#\tiProfiling (0= not considered, 1= time and memory allocations of each stage, profile.txt and profile.json)\n')
+    file.write('0\t#\tiTrace (0= not considered, 1= events of the time steps, stages and solvers, trace.json)\n')
+    file.write('0\t#\tiStatePrecision (0= diffusion modes stored in double precision, 1= diffusion modes stored in single precision between the time steps)\n')
+    file.write('0\t#\tiDiffusionModes (0= 40 modes in the spectral diffusion solvers, k= k modes, k <= 40)\n')
+    file.write('0\t#\tiAdaptiveModes (0= all the modes advanced, k= highest modes truncated below 10^-k of the gas in grain)\n')
+    file.write('0\t#\tiNewtonWarmStart (0= fixed first guesses of the Newton solvers, 1= last converged root of the node)')
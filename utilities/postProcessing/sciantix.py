@@ -61,6 +61,48 @@ def import_data(filename):
 	data = np.genfromtxt(filename, dtype= 'str', delimiter='\t')  # Convert the file data to numpy array
 	return data
 
+# Function to import one column of the binary columnar output (output.bin, iOutput = 3)
+def import_binary_column(filename, variable_name):
+	"""
+	This function reads the column variable_name (e.g., "Temperature (K)") from output.bin,
+	memory-mapping the file and reading only that column from each chunk (see include/ColumnarOutput.h)
+	"""
+
+	if(is_output_here(filename) is False):
+		return
+	data = np.memmap(filename, dtype=np.uint8, mode='r')
+	if bytes(data[0:8]) != b'SCXCOL1\0':
+		print("ERROR: ", filename, " is not a columnar output!")
+		return
+
+	n_columns = int(np.frombuffer(data, np.int32, 1, 8)[0])
+	position = 16
+	index = -1
+	for i in range(n_columns):
+		position += 4  # kind
+		length = int(np.frombuffer(data, np.int32, 1, position)[0])
+		name = bytes(data[position + 4:position + 4 + length]).decode()
+		position += 4 + length
+		length = int(np.frombuffer(data, np.int32, 1, position)[0])
+		uom = bytes(data[position + 4:position + 4 + length]).decode()
+		position += 4 + length
+		if variable_name in (name, name + " " + uom):
+			index = i
+	position = (position + 7) // 8 * 8
+	if index < 0:
+		print("ERROR: ", variable_name, " not found in ", filename)
+		return
+
+	blocks = []
+	while position + 8 <= len(data):
+		n_rows = int(np.frombuffer(data, np.int64, 1, position)[0])
+		position += 8
+		if position + 8 * n_rows * n_columns > len(data):
+			break
+		blocks.append(np.frombuffer(data, np.float64, n_rows, position + 8 * n_rows * index))
+		position += 8 * n_rows * n_columns
+	return np.concatenate(blocks) if blocks else np.array([])
+
 # Function to get the column index of a given variable in the ndarray
 def findSciantixVariablePosition(output, variable_name):
 	"""